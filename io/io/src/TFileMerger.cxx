@@ -373,16 +373,25 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
+/// Merge the RNTuple with the given name from all the sources into the file of the target directory.
+/// The inputs passed to RNTuple::Merge() are the name of the ntuple, the output file, and the input files.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *anchor, const char *ntupleName, TDirectory *target,
+                       const TList &sources)
+{
+   if (!rntupleHandle || !rntupleHandle->GetMerge() || !target->GetFile()) {
       return Long64_t(-1);
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
+   TObjString name(ntupleName);
+   TList inputs;
+   inputs.Add(&name);
+   inputs.Add(target->GetFile());
+   TIter nextsource(&sources);
+   while (TObject *source = nextsource()) {
+      inputs.Add(source);
+   }
+   TFileMergeInfo info(target);
    ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+   return func(anchor, &inputs, &info);
 }
 
 } // anonymous namespace
@@ -567,14 +576,21 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                // merge objects that don't derive from TObject
                if (std::string(key->GetClassName()) == "ROOT::Experimental::RNTuple") {
                   Warning("MergeRecursive", "merging RNTuples is experimental");
-                  // todo(max): check if this works when a TDirectory is passed as the first
-                  // input argument
-                  Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+                  if (path.Length() > 0) {
+                     Error("MergeRecursive", "merging RNTuples in sub directories is unimplemented (key: %s)",
+                           key->GetName());
+                     cl->Destructor(obj);
+                     return kFALSE;
+                  }
+                  Long64_t mergeResult = MergeRNTuples(cl, obj, key->GetName(), target, *sourcelist);
+                  cl->Destructor(obj);
                   if (mergeResult < 0) {
                      Error("MergeRecursive", "error merging RNTuples");
                      return kFALSE;
                   }
-                  return kTRUE;
+                  // The merged ntuple is already written to the target file
+                  oldkeyname = key->GetName();
+                  continue;
                }
                TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
                Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
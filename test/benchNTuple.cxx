@@ -0,0 +1,453 @@
+// This program compares the I/O performance of RNTuple and TTree for
+// synthetic LHC-like event schemas:
+//  -flat:    a fixed number of float values per event
+//  -jagged:  variable-length vectors of floats (particle kinematics)
+//  -nested:  a variable-length collection of tracks, each with its own
+//            variable-length collection of hits
+// Every schema is written and read back with both formats for several
+// compression settings and thread counts.  For every configuration, the
+// program prints the write throughput (on-disk MB/s), the file size, the
+// read throughput (events/s), the time spent decompressing, and the peak
+// resident memory above the baseline of the respective write and read phase.
+//
+//  run with
+//     benchNTuple
+//   or
+//     benchNTuple -s        for a short run (used as ctest)
+//     benchNTuple -n N      to process N events per configuration
+//     benchNTuple -j N      to also run with N threads (implicit multi-threading)
+//     benchNTuple -c C,...  to use the given comma separated compression settings
+//
+// Files are written into the current directory and removed afterwards.
+
+#include "TFile.h"
+#include "TROOT.h"
+#include "TStopwatch.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreePerfStats.h"
+
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+
+#include "benchNTuple.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleReader = ROOT::Experimental::RNTupleReader;
+using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
+using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
+
+namespace {
+
+/// Polls the resident memory of the process in a background thread and keeps the maximum
+class TMemoryWatcher {
+   std::atomic<bool> fStop{false};
+   Long_t fBaseline = 0;
+   std::atomic<Long_t> fPeak{0};
+   std::thread fThread;
+
+   static Long_t GetResidentKB()
+   {
+      ProcInfo_t info;
+      gSystem->GetProcInfo(&info);
+      return info.fMemResident;
+   }
+
+public:
+   TMemoryWatcher() : fBaseline(GetResidentKB()), fPeak(fBaseline)
+   {
+      fThread = std::thread([this]() {
+         while (!fStop) {
+            fPeak = std::max(fPeak.load(), GetResidentKB());
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+         }
+      });
+   }
+   ~TMemoryWatcher() { Stop(); }
+
+   /// Returns the peak resident memory above the baseline in MB
+   double Stop()
+   {
+      if (fThread.joinable()) {
+         fStop = true;
+         fThread.join();
+         fPeak = std::max(fPeak.load(), GetResidentKB());
+      }
+      return (fPeak - fBaseline) / 1024.;
+   }
+};
+
+/// An event layout that can be bound to an RNTuple model and to a TTree.  The same event data members are used
+/// for both formats, so that writing and reading do the same work except for the I/O layer.
+class TBenchSchema {
+public:
+   virtual ~TBenchSchema() = default;
+   virtual const char *GetName() const = 0;
+   virtual void Bind(RNTupleModel &model) = 0;
+   virtual void BindWrite(TTree &tree) = 0;
+   virtual void BindRead(TTree &tree) = 0;
+   virtual void Generate(std::mt19937 &rng) = 0;
+   /// Accumulates the event content after reading, so that reading cannot be optimized away
+   virtual double GetChecksum() const = 0;
+};
+
+class TFlatSchema : public TBenchSchema {
+   static constexpr int kNValues = 16;
+   std::array<float, kNValues> fValues{};
+
+public:
+   const char *GetName() const final { return "flat"; }
+   void Bind(RNTupleModel &model) final
+   {
+      for (int i = 0; i < kNValues; ++i)
+         model.AddField(("f" + std::to_string(i)).c_str(), &fValues[i]);
+   }
+   void BindWrite(TTree &tree) final
+   {
+      for (int i = 0; i < kNValues; ++i)
+         tree.Branch(("f" + std::to_string(i)).c_str(), &fValues[i]);
+   }
+   void BindRead(TTree &tree) final
+   {
+      for (int i = 0; i < kNValues; ++i)
+         tree.SetBranchAddress(("f" + std::to_string(i)).c_str(), &fValues[i]);
+   }
+   void Generate(std::mt19937 &rng) final
+   {
+      std::normal_distribution<float> gauss(0, 1);
+      for (auto &v : fValues)
+         v = gauss(rng);
+   }
+   double GetChecksum() const final
+   {
+      double sum = 0;
+      for (auto v : fValues)
+         sum += v;
+      return sum;
+   }
+};
+
+class TJaggedSchema : public TBenchSchema {
+   std::vector<float> fPt;
+   std::vector<float> fEta;
+   std::vector<float> fPhi;
+   std::vector<float> *fPtPtr = &fPt;
+   std::vector<float> *fEtaPtr = &fEta;
+   std::vector<float> *fPhiPtr = &fPhi;
+
+public:
+   const char *GetName() const final { return "jagged"; }
+   void Bind(RNTupleModel &model) final
+   {
+      model.AddField("pt", &fPt);
+      model.AddField("eta", &fEta);
+      model.AddField("phi", &fPhi);
+   }
+   void BindWrite(TTree &tree) final
+   {
+      tree.Branch("pt", &fPt);
+      tree.Branch("eta", &fEta);
+      tree.Branch("phi", &fPhi);
+   }
+   void BindRead(TTree &tree) final
+   {
+      tree.SetBranchAddress("pt", &fPtPtr);
+      tree.SetBranchAddress("eta", &fEtaPtr);
+      tree.SetBranchAddress("phi", &fPhiPtr);
+   }
+   void Generate(std::mt19937 &rng) final
+   {
+      std::poisson_distribution<int> multiplicity(20);
+      std::exponential_distribution<float> pt(0.1);
+      std::uniform_real_distribution<float> eta(-2.5, 2.5);
+      std::uniform_real_distribution<float> phi(-3.1416, 3.1416);
+      const auto n = multiplicity(rng);
+      fPt.resize(n);
+      fEta.resize(n);
+      fPhi.resize(n);
+      for (int i = 0; i < n; ++i) {
+         fPt[i] = pt(rng);
+         fEta[i] = eta(rng);
+         fPhi[i] = phi(rng);
+      }
+   }
+   double GetChecksum() const final
+   {
+      double sum = 0;
+      for (std::size_t i = 0; i < fPt.size(); ++i)
+         sum += fPt[i] + fEta[i] + fPhi[i];
+      return sum;
+   }
+};
+
+class TNestedSchema : public TBenchSchema {
+   std::vector<BenchTrack> fTracks;
+   std::vector<BenchTrack> *fTracksPtr = &fTracks;
+
+public:
+   const char *GetName() const final { return "nested"; }
+   void Bind(RNTupleModel &model) final { model.AddField("tracks", &fTracks); }
+   void BindWrite(TTree &tree) final { tree.Branch("tracks", &fTracks); }
+   void BindRead(TTree &tree) final { tree.SetBranchAddress("tracks", &fTracksPtr); }
+   void Generate(std::mt19937 &rng) final
+   {
+      std::poisson_distribution<int> nTracks(10);
+      std::poisson_distribution<int> nHits(12);
+      std::exponential_distribution<float> pt(0.1);
+      std::uniform_real_distribution<float> angle(-3.1416, 3.1416);
+      std::normal_distribution<float> pos(0, 10);
+      fTracks.resize(nTracks(rng));
+      for (auto &t : fTracks) {
+         t.fPt = pt(rng);
+         t.fEta = angle(rng) * 0.8;
+         t.fPhi = angle(rng);
+         t.fHits.resize(nHits(rng));
+         for (auto &h : t.fHits) {
+            h.fX = pos(rng);
+            h.fY = pos(rng);
+            h.fZ = pos(rng);
+         }
+      }
+   }
+   double GetChecksum() const final
+   {
+      double sum = 0;
+      for (const auto &t : fTracks) {
+         sum += t.fPt + t.fEta + t.fPhi;
+         for (const auto &h : t.fHits)
+            sum += h.fX + h.fY + h.fZ;
+      }
+      return sum;
+   }
+};
+
+struct TBenchResult {
+   std::string fSchema;
+   std::string fFormat;
+   int fCompression = 0;
+   unsigned int fNThreads = 1;
+   double fWriteRealTime = 0;
+   Long64_t fFileSize = 0;
+   double fWritePeakMB = 0;
+   double fReadRealTime = 0;
+   double fUnzipTime = 0;
+   double fReadPeakMB = 0;
+   double fChecksum = 0;
+};
+
+Long64_t GetFileSize(const std::string &path)
+{
+   FileStat_t st;
+   if (gSystem->GetPathInfo(path.c_str(), st) != 0)
+      return 0;
+   return st.fSize;
+}
+
+void RunNTuple(TBenchSchema &schema, int nevents, TBenchResult &result)
+{
+   const std::string path = std::string("benchNTuple_") + schema.GetName() + ".ntuple.root";
+   TStopwatch timer;
+
+   {
+      TMemoryWatcher memory;
+      timer.Start();
+      auto model = RNTupleModel::Create();
+      schema.Bind(*model);
+      RNTupleWriteOptions options;
+      options.SetCompression(result.fCompression);
+      // The multi-threaded runs compress the pages in the implicit task arena, as TTree does with its baskets
+      if (result.fNThreads > 1)
+         options.SetUseParallelZip(true);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "Events", path, options);
+      std::mt19937 rng(42);
+      for (int i = 0; i < nevents; ++i) {
+         schema.Generate(rng);
+         writer->Fill();
+      }
+      writer.reset();
+      timer.Stop();
+      result.fWritePeakMB = memory.Stop();
+   }
+   result.fWriteRealTime = timer.RealTime();
+   result.fFileSize = GetFileSize(path);
+
+   {
+      TMemoryWatcher memory;
+      timer.Start(kTRUE);
+      auto model = RNTupleModel::Create();
+      schema.Bind(*model);
+      auto reader = RNTupleReader::Open(std::move(model), "Events", path);
+      reader->EnableMetrics();
+      for (auto i : reader->GetEntryRange()) {
+         reader->LoadEntry(i);
+         result.fChecksum += schema.GetChecksum();
+      }
+      timer.Stop();
+      result.fReadPeakMB = memory.Stop();
+      auto ctrUnzip = reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.timeWallUnzip");
+      if (ctrUnzip)
+         result.fUnzipTime = ctrUnzip->GetValueAsInt() / 1e9;
+   }
+   result.fReadRealTime = timer.RealTime();
+
+   gSystem->Unlink(path.c_str());
+}
+
+void RunTree(TBenchSchema &schema, int nevents, TBenchResult &result)
+{
+   const std::string path = std::string("benchNTuple_") + schema.GetName() + ".tree.root";
+   TStopwatch timer;
+
+   {
+      TMemoryWatcher memory;
+      timer.Start();
+      TFile file(path.c_str(), "RECREATE", "", result.fCompression);
+      auto tree = new TTree("Events", "benchNTuple");
+      schema.BindWrite(*tree);
+      std::mt19937 rng(42);
+      for (int i = 0; i < nevents; ++i) {
+         schema.Generate(rng);
+         tree->Fill();
+      }
+      file.Write();
+      file.Close();
+      timer.Stop();
+      result.fWritePeakMB = memory.Stop();
+   }
+   result.fWriteRealTime = timer.RealTime();
+   result.fFileSize = GetFileSize(path);
+
+   {
+      TMemoryWatcher memory;
+      timer.Start(kTRUE);
+      TFile file(path.c_str(), "READ");
+      auto tree = file.Get<TTree>("Events");
+      schema.BindRead(*tree);
+      TTreePerfStats perfStats("ioperf", tree);
+      const auto nEntries = tree->GetEntries();
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         tree->GetEntry(i);
+         result.fChecksum += schema.GetChecksum();
+      }
+      timer.Stop();
+      result.fReadPeakMB = memory.Stop();
+      result.fUnzipTime = perfStats.GetUnzipTime();
+      tree->ResetBranchAddresses();
+   }
+   result.fReadRealTime = timer.RealTime();
+
+   gSystem->Unlink(path.c_str());
+}
+
+void PrintResult(const TBenchResult &r, int nevents)
+{
+   const double sizeMB = r.fFileSize / (1024. * 1024.);
+   printf("%-7s %-8s %5d %3u | %9.2f %9.2f %8.1f | %11.0f %8.3f %8.1f\n", r.fSchema.c_str(), r.fFormat.c_str(),
+          r.fCompression, r.fNThreads, (r.fWriteRealTime > 0) ? sizeMB / r.fWriteRealTime : 0., sizeMB, r.fWritePeakMB,
+          (r.fReadRealTime > 0) ? nevents / r.fReadRealTime : 0., r.fUnzipTime, r.fReadPeakMB);
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   bool shortrun = false;
+   int nevents = -1;
+   unsigned int nthreads = 0;
+   std::vector<int> compressions{0, 101, 404, 505};
+   for (int a = 1; a < argc; ++a) {
+      if (!strcmp(argv[a], "-s")) {
+         shortrun = true;
+      } else if (!strcmp(argv[a], "-n") && (a + 1 < argc)) {
+         nevents = atoi(argv[++a]);
+      } else if (!strcmp(argv[a], "-j") && (a + 1 < argc)) {
+         nthreads = atoi(argv[++a]);
+      } else if (!strcmp(argv[a], "-c") && (a + 1 < argc)) {
+         compressions.clear();
+         std::stringstream list(argv[++a]);
+         std::string item;
+         while (std::getline(list, item, ','))
+            compressions.emplace_back(atoi(item.c_str()));
+      } else {
+         printf("Usage: %s [-s] [-n nevents] [-j nthreads] [-c compression,...]\n", argv[0]);
+         return 1;
+      }
+   }
+   if (nevents <= 0)
+      nevents = shortrun ? 1000 : 200000;
+   if (shortrun)
+      compressions = {0, 505};
+
+   std::vector<unsigned int> threadCounts{1};
+#ifdef R__USE_IMT
+   if (nthreads > 1)
+      threadCounts.push_back(nthreads);
+#else
+   if (nthreads > 1)
+      printf("benchNTuple: ROOT is built without implicit multi-threading, ignoring -j %u\n", nthreads);
+#endif
+
+   std::vector<std::unique_ptr<TBenchSchema>> schemas;
+   schemas.emplace_back(new TFlatSchema());
+   schemas.emplace_back(new TJaggedSchema());
+   schemas.emplace_back(new TNestedSchema());
+
+   printf("benchNTuple: %d events per configuration\n\n", nevents);
+   printf("%-7s %-8s %5s %3s | %9s %9s %8s | %11s %8s %8s\n", "schema", "format", "comp", "thr", "write MB/s",
+          "size MB", "peak MB", "read evt/s", "unzip s", "peak MB");
+   printf("------------------------------------------------------------------------------------------\n");
+
+   int nFailures = 0;
+   for (auto nThreadsRun : threadCounts) {
+#ifdef R__USE_IMT
+      if (nThreadsRun > 1)
+         ROOT::EnableImplicitMT(nThreadsRun);
+#endif
+      for (const auto &schema : schemas) {
+         for (auto compression : compressions) {
+            TBenchResult resultNTuple;
+            resultNTuple.fSchema = schema->GetName();
+            resultNTuple.fFormat = "RNTuple";
+            resultNTuple.fCompression = compression;
+            resultNTuple.fNThreads = nThreadsRun;
+            RunNTuple(*schema, nevents, resultNTuple);
+            PrintResult(resultNTuple, nevents);
+
+            TBenchResult resultTree = resultNTuple;
+            resultTree.fFormat = "TTree";
+            resultTree.fChecksum = 0;
+            RunTree(*schema, nevents, resultTree);
+            PrintResult(resultTree, nevents);
+
+            // Both formats have to return the very same data
+            if (resultNTuple.fChecksum != resultTree.fChecksum) {
+               printf("benchNTuple: checksum mismatch for %s, compression %d: %f (RNTuple) vs. %f (TTree)\n",
+                      schema->GetName(), compression, resultNTuple.fChecksum, resultTree.fChecksum);
+               nFailures++;
+            }
+         }
+      }
+#ifdef R__USE_IMT
+      if (nThreadsRun > 1)
+         ROOT::DisableImplicitMT();
+#endif
+   }
+
+   return (nFailures == 0) ? 0 : 1;
+}
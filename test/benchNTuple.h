@@ -0,0 +1,22 @@
+#ifndef ROOT_BENCHNTUPLE
+#define ROOT_BENCHNTUPLE
+
+// Event classes of the nested schema of benchNTuple; the data is stored once
+// through RNTuple class fields and once through split TTree branches.
+
+#include <vector>
+
+struct BenchHit {
+   float fX = 0;
+   float fY = 0;
+   float fZ = 0;
+};
+
+struct BenchTrack {
+   float fPt = 0;
+   float fEta = 0;
+   float fPhi = 0;
+   std::vector<BenchHit> fHits;
+};
+
+#endif
@@ -0,0 +1,12 @@
+#ifdef __CINT__
+
+#pragma link off all globals;
+#pragma link off all classes;
+#pragma link off all functions;
+
+#pragma link C++ class BenchHit+;
+#pragma link C++ class BenchTrack+;
+#pragma link C++ class std::vector<BenchHit>+;
+#pragma link C++ class std::vector<BenchTrack>+;
+
+#endif
@@ -5,10 +5,18 @@
 #include "ROOT/RDataSource.hxx"
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace arrow {
+class RecordBatchReader;
+class Schema;
 class Table;
-}
+namespace ipc {
+class RecordBatchFileReader;
+} // namespace ipc
+} // namespace arrow
 
 namespace ROOT {
 namespace Internal {
@@ -21,17 +29,25 @@ namespace RDF {
 
 class RArrowDS final : public RDataSource {
 private:
-   std::shared_ptr<arrow::Table> fTable;
-   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+   std::shared_ptr<arrow::Schema> fSchema;
+   std::shared_ptr<arrow::Table> fTable;                            ///< The table to read, if any
+   std::shared_ptr<arrow::ipc::RecordBatchFileReader> fFileReader; ///< The IPC file to read, if any
+   /// The source of the record batches of the current event loop. For a table or an IPC file, one per event loop.
+   std::shared_ptr<arrow::RecordBatchReader> fBatchReader;
+   bool fBatchReaderConsumed = false; ///< Whether the record batches of a RecordBatchReader passed by the user were read
+   ULong64_t fNextEntry = 0ULL;       ///< The first entry of the next record batch
    std::vector<std::string> fColumnNames;
    size_t fNSlots = 0U;
 
    std::vector<std::pair<size_t, size_t>> fGetterIndex; // (columnId, visitorId)
    std::vector<std::unique_ptr<ROOT::Internal::RDF::TValueGetter>> fValueGetters; // Visitors to be used to track and get entries. One per column.
    std::vector<void *> GetColumnReadersImpl(std::string_view name, const std::type_info &type) override;
+   void SetupColumns();
 
 public:
    RArrowDS(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
+   RArrowDS(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columns);
+   RArrowDS(std::string_view fileName, std::vector<std::string> const &columns);
    ~RArrowDS();
    const std::vector<std::string> &GetColumnNames() const override;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() override;
@@ -41,6 +57,7 @@ public:
    void InitSlot(unsigned int slot, ULong64_t firstEntry) override;
    void SetNSlots(unsigned int nSlots) override;
    void Initialise() override;
+   void Finalise() override;
    std::string GetLabel() override;
 };
 
@@ -49,6 +66,17 @@ public:
 /// \param[in] table an apache::arrow table to use as a source.
 RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
 
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Factory method to create a Apache Arrow RDataFrame that streams record batches.
+/// \param[in] batchReader an arrow::RecordBatchReader to read the record batches from, in a single event loop.
+RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::RecordBatchReader> batchReader,
+                              std::vector<std::string> const &columns);
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Factory method to create a Apache Arrow RDataFrame that streams the record batches of an Arrow IPC file.
+/// \param[in] fileName the name of a file in the Arrow IPC file format.
+RDataFrame MakeArrowIPCDataFrame(std::string_view fileName, std::vector<std::string> const &columns);
+
 } // namespace RDF
 
 } // namespace ROOT
@@ -14,11 +14,13 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RDataSource.hxx"
 
+#include <cstddef>
 #include <cstdint>
 #include <deque>
-#include <list>
 #include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <TRegexp.h>
@@ -41,7 +43,21 @@ private:
    // Regular expressions for type inference
    static const TRegexp fgIntRegex, fgDoubleRegex1, fgDoubleRegex2, fgDoubleRegex3, fgTrueRegex, fgFalseRegex;
 
+   /// The values of the entries of an entry range, column by column. Only the vectors of the column type are filled.
+   struct RParsedRange {
+      ULong64_t fFirstEntry = 0ULL;
+      ULong64_t fNEntries = 0ULL;
+      std::vector<std::vector<double>> fDoubles;
+      std::vector<std::vector<Long64_t>> fLong64s;
+      std::vector<std::vector<std::string>> fStrings;
+      // This must be a deque to avoid the specialisation vector<bool>. This would not
+      // work given that the pointer to the boolean in that case cannot be taken
+      std::vector<std::deque<bool>> fBools;
+      std::string fScratch; ///< Buffer for the unescaping of quoted fields, reused across lines
+   };
+
    std::uint64_t fDataPos = 0;
+   std::uint64_t fChunkPos = 0; ///< Position in the file of the first line that has not been read yet
    bool fReadHeaders = false;
    unsigned int fNSlots = 0U;
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
@@ -51,24 +67,21 @@ private:
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
    std::vector<std::string> fHeaders;
    std::map<std::string, ColType_t> fColTypes;
-   std::list<ColType_t> fColTypesList;
+   std::vector<ColType_t> fColTypesList;
    std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot]
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column]
-   std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
-   std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
-   std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
-   // This must be a deque to avoid the specialisation vector<bool>. This would not
-   // work given that the pointer to the boolean in that case cannot be taken
-   std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
+   std::string fChunk;                                     ///< The raw content of the lines of the current chunk
+   std::vector<std::pair<std::size_t, std::size_t>> fLines; ///< Begin and end of the non-empty lines in fChunk
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges; ///< The entry ranges of the current chunk
+   std::vector<RParsedRange> fParsedRanges;                ///< The range each slot is processing, parsed
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &);
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
    std::vector<std::string> ParseColumns(const std::string &);
-   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   void ReadChunk();
+   void ParseRange(unsigned int slot, ULong64_t entry);
    ColType_t GetType(std::string_view colName) const;
 
 protected:
@@ -94,6 +107,8 @@ public:
 /// \param[in] readHeaders `true` if the CSV file contains headers as first row, `false` otherwise
 ///                        (default `true`).
 /// \param[in] delimiter Delimiter character (default ',').
+/// \param[in] linesChunkSize Number of lines read from the file at a time, -1 (the default) to read chunks of
+///                           about 16 MB per processing slot.
 RDataFrame MakeCsvDataFrame(std::string_view fileName, bool readHeaders = true, char delimiter = ',',
                             Long64_t linesChunkSize = -1LL);
 
@@ -16,6 +16,8 @@
 #include "RDefineReader.hxx"
 #include "RDSColumnReader.hxx"
 #include "RTreeColumnReader.hxx"
+#include "RVariationBase.hxx"
+#include "RVariationReader.hxx"
 
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/TypeTraits.hxx>
@@ -65,8 +67,21 @@ template <typename T>
 std::unique_ptr<RDFDetail::RColumnReaderBase>
 MakeColumnReadersHelper(unsigned int slot, RDFDetail::RDefineBase *define,
                         const std::map<std::string, std::vector<void *>> &DSValuePtrsMap, TTreeReader *r,
-                        ROOT::RDF::RDataSource *ds, const std::string &colName)
+                        ROOT::RDF::RDataSource *ds, const std::string &colName, const RBookedDefines &customCols,
+                        const std::string &variationName)
 {
+   if (variationName != "nominal") {
+      // in a varied universe, a variation of the column (if any) replaces its nominal values...
+      auto *variation = customCols.FindVariation(colName, variationName);
+      if (variation != nullptr) {
+         return std::unique_ptr<RDFDetail::RColumnReaderBase>(
+            new RVariationReader(slot, *variation, variation->GetVariationIndex(variationName), typeid(T)));
+      }
+      // ...and defined columns are read from their varied clones, if they depend on this universe
+      if (define != nullptr)
+         define = &define->GetVariedDefine(variationName);
+   }
+
    const auto DSValuePtrsIt = DSValuePtrsMap.find(colName);
    const std::vector<void *> *DSValuePtrsPtr = DSValuePtrsIt != DSValuePtrsMap.end() ? &DSValuePtrsIt->second : nullptr;
    R__ASSERT(define != nullptr || r != nullptr || DSValuePtrsPtr != nullptr || ds != nullptr);
@@ -83,6 +98,7 @@ struct RColumnReadersInfo {
    const bool *fIsDefine;
    const std::map<std::string, std::vector<void *>> &fDSValuePtrsMap;
    ROOT::RDF::RDataSource *fDataSource;
+   const std::string &fVariation; ///< The universe the values are read for, "nominal" for the unvaried values
 };
 
 /// Create a group of column readers, one per type in the parameter pack.
@@ -98,13 +114,14 @@ MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, cons
    const bool *isDefine = colInfo.fIsDefine;
    const auto &DSValuePtrsMap = colInfo.fDSValuePtrsMap;
    auto *ds = colInfo.fDataSource;
+   const auto &variationName = colInfo.fVariation;
 
    const auto &customColMap = customCols.GetColumns();
 
    int i = -1;
    std::array<std::unique_ptr<RDFDetail::RColumnReaderBase>, sizeof...(ColTypes)> ret{
       {{(++i, MakeColumnReadersHelper<ColTypes>(slot, isDefine[i] ? customColMap.at(colNames[i]).get() : nullptr,
-                                                DSValuePtrsMap, r, ds, colNames[i]))}...}};
+                                                DSValuePtrsMap, r, ds, colNames[i], customCols, variationName))}...}};
    return ret;
 
    // avoid bogus "unused variable" warnings
@@ -131,7 +131,11 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h,
 {
    using Helper_t = FillParHelper<ActionResultType>;
    using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
-   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), defines);
+   auto action = std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), defines);
+   // Fill() of user classes runs their compiled Fill method
+   if (!std::is_base_of<::TH1, ActionResultType>::value)
+      action->SetDependsOnCompiledCode();
+   return action;
 }
 
 // Histo1D filling (must handle the special case of distinguishing FillParHelper and FillHelper
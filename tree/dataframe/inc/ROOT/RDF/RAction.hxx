@@ -18,10 +18,14 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
 
+#include <algorithm> // std::find
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <typeinfo>
 #include <vector>
 
 namespace ROOT {
@@ -62,14 +66,19 @@ class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
 public:
-   RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines)
-      : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines), fHelper(std::forward<Helper>(h)),
+   RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines,
+           const std::string &variationName = "nominal")
+      : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines, variationName), fHelper(std::forward<Helper>(h)),
         fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine()
    {
       const auto nColumns = columns.size();
       const auto &customCols = GetDefines();
-      for (auto i = 0u; i < nColumns; ++i)
+      for (auto i = 0u; i < nColumns; ++i) {
          fIsDefine[i] = customCols.HasName(columns[i]);
+         // the varied clones of the input Defines must exist before the event loop, see GetVariedDefine
+         if (fIsDefine[i] && variationName != "nominal")
+            customCols.GetColumns().at(columns[i])->GetVariedDefine(variationName);
+      }
    }
 
    RAction(const RAction &) = delete;
@@ -93,8 +102,13 @@ public:
    {
       for (auto &bookedBranch : GetDefines().GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      if (GetVariation() != "nominal") {
+         for (auto &variation : GetDefines().GetVariations())
+            variation.second->InitSlot(r, slot);
+      }
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
-                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource(),
+                                           GetVariation()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
       fHelper.InitTask(r, slot);
    }
@@ -113,6 +127,25 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const RMaskedEntryRange &mask, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(mask)...};
+      const auto bulkSize = mask.Size();
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (mask[i])
+            fHelper.Exec(slot, std::get<S>(values)[i]...);
+      }
+      (void)values; // avoid "unused variable" warnings for actions without input columns
+   }
+
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      const auto &mask = fPrevData.CheckFiltersBulk(slot, firstEntry, bulkSize);
+      if (mask.Any())
+         CallExecBulk(slot, mask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
@@ -120,6 +153,10 @@ public:
    {
       for (auto &column : GetDefines().GetColumns())
          column.second->FinaliseSlot(slot);
+      if (GetVariation() != "nominal") {
+         for (auto &variation : GetDefines().GetVariations())
+            variation.second->FinaliseSlot(slot);
+      }
       for (auto &v : fValues[slot])
          v.reset();
       fHelper.CallFinalizeTask(slot);
@@ -153,7 +190,57 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return PartialUpdateImpl(slot); }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      return RDFInternal::Union(fPrevData.GetVariations(), GetDefines().GetVariationDeps(GetColumnNames()));
+   }
+
+   /// Actions are identified by the type of their helper: the parameters of the helper that affect the result, such as
+   /// the model of a histogram, are part of the initial state of the result (see RCachedResultBase).
+   /// Helpers that run compiled user code are identified by their type and the code version.
+   std::string GetFingerprint() const final
+   {
+      const auto prevFingerprint = fPrevData.GetFingerprint();
+      if (prevFingerprint.empty())
+         return "";
+      const auto &codeVersion = fLoopManager->GetResultCacheCodeVersion();
+      const std::string helperId = DependsOnCompiledCode() ? RDFInternal::GetCompiledCodeId(typeid(Helper), codeVersion)
+                                                           : typeid(Helper).name();
+      const auto inputFingerprint = GetDefines().GetFingerprint(GetColumnNames(), codeVersion);
+      if (helperId.empty() || inputFingerprint.empty())
+         return "";
+      return RDFInternal::MakeFingerprint("Action " + helperId + " " + GetVariation() + " " + inputFingerprint + " " +
+                                          prevFingerprint);
+   }
+
+   std::unique_ptr<RActionBase> MakeVariedAction(const std::string &variationName, void *newResult) final
+   {
+      auto prevNode = fPrevDataPtr;
+      const auto prevVariations = fPrevData.GetVariations();
+      if (std::find(prevVariations.begin(), prevVariations.end(), variationName) != prevVariations.end())
+         prevNode = std::static_pointer_cast<PrevDataFrame>(fPrevData.GetVariedFilter(variationName));
+
+      std::unique_ptr<RActionBase> variedAction(
+         new RAction(MakeNewHelper(newResult, 0), GetColumnNames(), std::move(prevNode), GetDefines(), variationName));
+      if (DependsOnCompiledCode())
+         variedAction->SetDependsOnCompiledCode();
+      return variedAction;
+   }
+
 private:
+   // this overload is SFINAE'd out if Helper does not implement `MakeNew`
+   template <typename H = Helper>
+   auto MakeNewHelper(void *newResult, int) -> decltype(std::declval<H>().MakeNew(newResult))
+   {
+      return fHelper.MakeNew(newResult);
+   }
+
+   // this one is always available but has lower precedence thanks to `...`
+   Helper MakeNewHelper(void *, ...)
+   {
+      throw std::logic_error("The " + fHelper.GetActionName() + " action does not support systematic variations.");
+   }
+
    // this overload is SFINAE'd out if Helper does not implement `PartialUpdate`
    // the template parameter is required to defer instantiation of the method to SFINAE time
    template <typename H = Helper>
@@ -15,8 +15,10 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -33,6 +35,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RCachedResultBase;
 
 using namespace ROOT::Detail::RDF;
 
@@ -48,18 +51,30 @@ private:
    const ColumnNames_t fColumnNames;
 
    RBookedDefines fDefines;
+   /// The universe this action produces a result for, "nominal" unless this is a varied clone of another action.
+   const std::string fVariation;
+   /// Access to the result for the result cache, null if the result is not cached (see RLoopManager::SetResultCache).
+   std::unique_ptr<RCachedResultBase> fCachedResult;
+   /// Whether the helper runs compiled user code, e.g. a helper passed to Book(), see SetDependsOnCompiledCode().
+   bool fDependsOnCompiledCode = false;
 
 public:
-   RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines);
+   RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines,
+               const std::string &variationName = "nominal");
    RActionBase(const RActionBase &) = delete;
    RActionBase &operator=(const RActionBase &) = delete;
    virtual ~RActionBase();
 
    const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
    RBookedDefines &GetDefines() { return fDefines; }
+   const RBookedDefines &GetDefines() const { return fDefines; }
+   const std::string &GetVariation() const { return fVariation; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Bulk version of Run(): executes the action for the entries in [firstEntry, firstEntry + bulkSize) that pass
+   /// the upstream filters
+   virtual void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -80,6 +95,24 @@ public:
       with others of the same type.
    */
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const = 0;
+
+   /// Return the names of the universes that the result of this action depends on (see RVariationBase).
+   virtual std::vector<std::string> GetVariations() const = 0;
+
+   /// Create a clone of this action that produces its result in the given universe and stores it in `newResult`,
+   /// a type-erased pointer to a `std::shared_ptr` to the result type. The new action must be booked by the caller.
+   virtual std::unique_ptr<RActionBase> MakeVariedAction(const std::string &variationName, void *newResult) = 0;
+
+   /// Return a digest of the action, of its inputs and of the selection of its entries that is stable across
+   /// processes, or an empty string if the entries processed by the action cannot be identified.
+   virtual std::string GetFingerprint() const = 0;
+
+   void SetCachedResult(std::unique_ptr<RCachedResultBase> cachedResult);
+   RCachedResultBase *GetCachedResult() const { return fCachedResult.get(); }
+   /// Mark the result as computed by compiled user code. Its type does not change when the code is edited, so the
+   /// result is cached only if a code version is given (see RLoopManager::SetResultCache).
+   void SetDependsOnCompiledCode() { fDependsOnCompiledCode = true; }
+   bool DependsOnCompiledCode() const { return fDependsOnCompiledCode; }
 };
 } // namespace RDF
 } // namespace Internal
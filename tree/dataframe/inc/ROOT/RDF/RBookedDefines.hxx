@@ -22,6 +22,7 @@ namespace ROOT {
 namespace Detail {
 namespace RDF {
 class RDefineBase;
+class RVariationBase;
 }
 }
 
@@ -43,10 +44,14 @@ class RBookedDefines {
    // Since RBookedDefines is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RDefineBasePtrMapPtr_t = std::shared_ptr<const RDefineBasePtrMap_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
+   /// Systematic variations registered with Vary, keyed by the name of the varied column
+   using RVariationsMap_t = std::multimap<std::string, std::shared_ptr<RDFDetail::RVariationBase>>;
+   using RVariationsMapPtr_t = std::shared_ptr<const RVariationsMap_t>;
 
 private:
    RDefineBasePtrMapPtr_t fDefines;
    ColumnNamesPtr_t fDefinesNames;  // also abused to keep track of aliases for each branch of the computation graph
+   RVariationsMapPtr_t fVariations;
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -64,7 +69,7 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates the object starting from the provided maps
    RBookedDefines(RDefineBasePtrMapPtr_t defines, ColumnNamesPtr_t defineNames)
-      : fDefines(defines), fDefinesNames(defineNames)
+      : fDefines(defines), fDefinesNames(defineNames), fVariations(std::make_shared<RVariationsMap_t>())
    {
    }
 
@@ -72,7 +77,7 @@ public:
    /// \brief Creates a new wrapper with empty maps
    RBookedDefines()
       : fDefines(std::make_shared<RDefineBasePtrMap_t>()),
-        fDefinesNames(std::make_shared<ColumnNames_t>())
+        fDefinesNames(std::make_shared<ColumnNames_t>()), fVariations(std::make_shared<RVariationsMap_t>())
    {
    }
 
@@ -100,6 +105,32 @@ public:
    /// in each branch of the computation graph.
    /// Internally it recreates the vector with the new name, and swaps it with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Add a new systematic variation of a column.
+   /// Internally it recreates the map with the new variation, and swaps it with the old one.
+   void AddVariation(const std::shared_ptr<RDFDetail::RVariationBase> &variation);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the systematic variations registered so far, keyed by the name of the varied column
+   const RVariationsMap_t &GetVariations() const { return *fVariations; }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the variation of column colName that provides the values of the given universe, or nullptr.
+   /// Universes are named "variationName:tag", see RVariationBase.
+   RDFDetail::RVariationBase *FindVariation(const std::string &colName, const std::string &variationName) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return the sorted names of the universes that the values of the given columns depend on.
+   /// These are the universes of the variations of the columns themselves and, for defined columns, the universes
+   /// that the inputs of the Define depend on.
+   ColumnNames_t GetVariationDeps(const ColumnNames_t &columns) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Return a description of how the values of the given columns are computed that is stable across processes.
+   /// It contains the fingerprints of the defined columns and the variations registered for the columns.
+   /// It is empty if the values depend on compiled code and no code version is given.
+   std::string GetFingerprint(const ColumnNames_t &columns, const std::string &codeVersion) const;
 };
 
 } // Namespace RDF
@@ -11,8 +11,11 @@
 #ifndef ROOT_INTERNAL_RDF_RCOLUMNREADERBASE
 #define ROOT_INTERNAL_RDF_RCOLUMNREADERBASE
 
+#include <ROOT/RDF/RMaskedEntryRange.hxx>
 #include <Rtypes.h>
 
+#include <stdexcept>
+
 namespace ROOT {
 namespace Detail {
 namespace RDF {
@@ -38,8 +41,24 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return the column values for the entries of a bulk, stored contiguously starting at the returned address.
+   /// Only the values of the entries selected by the mask are guaranteed to be valid. Can be called several times
+   /// per bulk with masks selecting more entries, e.g. if the column is read by a Filter and by an action below it.
+   /// Only called in bulk mode, i.e. for readers of Defines and of data sources that support bulk reading.
+   /// \tparam T The column type
+   /// \param mask The bulk of entries and the subset of entries whose values are requested
+   template <typename T>
+   T *GetBulk(const ROOT::Internal::RDF::RMaskedEntryRange &mask)
+   {
+      return static_cast<T *>(GetBulkImpl(mask));
+   }
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange &)
+   {
+      throw std::logic_error("This column reader does not support bulk reading.");
+   }
 };
 
 } // namespace RDF
@@ -20,9 +20,16 @@
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
+#include <algorithm> // std::find
 #include <array>
+#include <cstddef> // std::size_t
 #include <deque>
+#include <memory>
+#include <string>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 class TTreeReader;
@@ -59,9 +66,18 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    using ValuesPerSlot_t =
       typename std::conditional<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>::type;
 
+   /// The values of the current bulk of a slot, stored contiguously, and the entries they have been evaluated for
+   struct RBulkValues {
+      std::unique_ptr<ret_type[]> fValues;
+      std::size_t fCapacity = 0;
+      RDFInternal::RMaskedEntryRange fEvaluated;
+      RDFInternal::RMaskedEntryRange fRequest; ///< Entries to be evaluated by the ongoing UpdateBulk() call
+   };
+
    F fExpression;
    const ColumnNames_t fColumnNames;
    ValuesPerSlot_t fLastResults;
+   std::vector<RBulkValues> fBulkValues;
 
    /// Column readers per slot and per input column
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
@@ -97,16 +113,56 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
       (void)entry;
    }
 
+   template <typename... Args>
+   ret_type EvalExpression(unsigned int, Long64_t, NoneTag, Args &&... args)
+   {
+      return fExpression(std::forward<Args>(args)...);
+   }
+
+   template <typename... Args>
+   ret_type EvalExpression(unsigned int slot, Long64_t, SlotTag, Args &&... args)
+   {
+      return fExpression(slot, std::forward<Args>(args)...);
+   }
+
+   template <typename... Args>
+   ret_type EvalExpression(unsigned int slot, Long64_t entry, SlotAndEntryTag, Args &&... args)
+   {
+      return fExpression(slot, entry, std::forward<Args>(args)...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, RBulkValues &bulk, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      const auto &request = bulk.fRequest;
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(request)...};
+      const auto firstEntry = request.FirstEntry();
+      const auto bulkSize = request.Size();
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!request[i])
+            continue;
+         bulk.fValues[i] = EvalExpression(slot, firstEntry + i, ExtraArgsTag{}, std::get<S>(values)[i]...);
+         bulk.fEvaluated[i] = true;
+      }
+      // silence "unused variable" warnings in gcc for expressions without input columns
+      (void)values;
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ColumnNames_t &columns,
                  unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
-                 const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds)
-      : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds), fExpression(std::move(expression)),
-        fColumnNames(columns), fLastResults(fNSlots), fValues(fNSlots), fIsDefine()
+                 const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds,
+                 std::string_view variationName = "nominal")
+      : RDefineBase(name, type, nSlots, defines, DSValuePtrs, ds, variationName), fExpression(std::move(expression)),
+        fColumnNames(columns), fLastResults(fNSlots), fBulkValues(fNSlots), fValues(fNSlots), fIsDefine()
    {
       const auto nColumns = fColumnNames.size();
-      for (auto i = 0u; i < nColumns; ++i)
+      for (auto i = 0u; i < nColumns; ++i) {
          fIsDefine[i] = fDefines.HasName(fColumnNames[i]);
+         // the varied clones of the input Defines must exist before the event loop, see GetVariedDefine
+         if (fIsDefine[i] && fVariation != "nominal")
+            fDefines.GetColumns().at(fColumnNames[i])->GetVariedDefine(fVariation);
+      }
    }
 
    RDefine(const RDefine &) = delete;
@@ -116,9 +172,13 @@ public:
    {
       if (!fIsInitialized[slot]) {
          fIsInitialized[slot] = true;
-         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource};
+         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource,
+                                              fVariation};
          fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
          fLastCheckedEntry[slot] = -1;
+         fBulkValues[slot].fEvaluated.Invalidate();
+         for (auto &varied : fVariedDefines)
+            varied.second->InitSlot(r, slot);
       }
    }
 
@@ -135,8 +195,67 @@ public:
       }
    }
 
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final
+   {
+      auto &bulk = fBulkValues[slot];
+      const auto bulkSize = mask.Size();
+      if (!bulk.fEvaluated.IsRange(mask.FirstEntry(), bulkSize)) {
+         if (bulk.fCapacity < bulkSize) {
+            bulk.fValues.reset(new ret_type[bulkSize]);
+            bulk.fCapacity = bulkSize;
+         }
+         bulk.fEvaluated.Reset(mask.FirstEntry(), bulkSize, false);
+      }
+      // only evaluate the requested entries that have not been evaluated for an earlier request in this bulk
+      auto &request = bulk.fRequest;
+      request.Reset(mask.FirstEntry(), bulkSize, false);
+      bool mustEvaluate = false;
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         request[i] = mask[i] && !bulk.fEvaluated[i];
+         mustEvaluate |= request[i];
+      }
+      if (mustEvaluate)
+         UpdateBulkHelper(slot, bulk, ColumnTypes_t{}, TypeInd_t{});
+      return static_cast<void *>(bulk.fValues.get());
+   }
+
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
 
+   std::vector<std::string> GetVariations() const final { return fDefines.GetVariationDeps(fColumnNames); }
+
+   RDefineBase &GetVariedDefine(const std::string &variationName) final
+   {
+      auto it = fVariedDefines.find(variationName);
+      if (it != fVariedDefines.end())
+         return *it->second;
+
+      const auto variations = GetVariations();
+      if (std::find(variations.begin(), variations.end(), variationName) == variations.end())
+         return *this;
+
+      auto &varied = fVariedDefines[variationName];
+      varied.reset(new RDefine(fName, fType, RDFInternal::CopyCallable(fExpression), fColumnNames, fNSlots, fDefines,
+                               fDSValuePtrs, fDataSource, variationName));
+      varied->SetExpressionId(fExpressionId);
+      return *varied;
+   }
+
+   /// Compiled expressions are identified by their type and the code version, jitted expressions by their code.
+   std::string GetFingerprint(const std::string &codeVersion) const final
+   {
+      if (fFingerprint.empty() || codeVersion != fFingerprintCodeVersion) {
+         const auto exprId =
+            fExpressionId.empty() ? RDFInternal::GetCompiledCodeId(typeid(F), codeVersion) : fExpressionId;
+         const auto inputFingerprint = fDefines.GetFingerprint(fColumnNames, codeVersion);
+         if (exprId.empty() || inputFingerprint.empty())
+            return "";
+         fFingerprint = RDFInternal::MakeFingerprint("Define " + fName + " " + exprId + " " +
+                                                     typeid(ExtraArgsTag).name() + " " + inputFingerprint);
+         fFingerprintCodeVersion = codeVersion;
+      }
+      return fFingerprint;
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinaliseSlot(unsigned int slot) final
    {
@@ -144,6 +263,8 @@ public:
          for (auto &v : fValues[slot])
             v.reset();
          fIsInitialized[slot] = false;
+         for (auto &varied : fVariedDefines)
+            varied.second->FinaliseSlot(slot);
       }
    }
 };
@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 
 #include <deque>
 #include <map>
@@ -46,13 +47,22 @@ protected:
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
    const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
    ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+   /// The universe whose values this Define computes, "nominal" unless this is a varied clone of another Define.
+   const std::string fVariation;
+   /// Clones of this Define that compute its values in the universes it depends on, created by GetVariedDefine.
+   std::map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
+   /// Identifies the expression in the fingerprint of this Define: the code of jitted expressions, empty otherwise.
+   std::string fExpressionId;
+   mutable std::string fFingerprint;            ///< Memoized result of GetFingerprint()
+   mutable std::string fFingerprintCodeVersion; ///< The code version that fFingerprint was computed with
 
    static unsigned int GetNextID();
 
 public:
    RDefineBase(std::string_view name, std::string_view type, unsigned int nSlots,
                const RDFInternal::RBookedDefines &defines,
-               const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+               const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds,
+               std::string_view variationName = "nominal");
 
    RDefineBase &operator=(const RDefineBase &) = delete;
    RDefineBase &operator=(RDefineBase &&) = delete;
@@ -65,10 +75,25 @@ public:
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Bulk version of Update(): evaluates the expression for the entries selected by the mask that have not been
+   /// evaluated yet and returns the (type-erased) address of the contiguous values of the bulk.
+   virtual void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) = 0;
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) = 0;
    /// Return the unique identifier of this RDefineBase.
    unsigned int GetID() const { return fID; }
+   /// Return the names of the universes that the values of this Define depend on (see RVariationBase).
+   virtual std::vector<std::string> GetVariations() const = 0;
+   /// Return the clone of this Define that computes its values in the given universe, or this Define itself if its
+   /// values do not depend on it. The clone is created on first request: the first call for each universe must
+   /// happen before the event loop starts, as it is not thread-safe.
+   virtual RDefineBase &GetVariedDefine(const std::string &variationName) = 0;
+   /// Set the string that identifies the expression of this Define in its fingerprint, see fExpressionId.
+   void SetExpressionId(const std::string &id) { fExpressionId = id; }
+   /// Return a digest of the expression and of the inputs of this Define that is stable across processes.
+   /// It is part of the keys of the results in the result cache (see RLoopManager::SetResultCache).
+   /// Return an empty string if the values depend on compiled code and no code version is given.
+   virtual std::string GetFingerprint(const std::string &codeVersion) const = 0;
 };
 
 } // ns RDF
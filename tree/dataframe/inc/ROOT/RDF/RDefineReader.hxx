@@ -15,8 +15,12 @@
 #include "RDefineBase.hxx"
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 
+#include <ROOT/RStringView.hxx>
+
 #include <limits>
+#include <string>
 #include <type_traits>
+#include <typeinfo>
 
 namespace ROOT {
 namespace Internal {
@@ -24,6 +28,10 @@ namespace RDF {
 
 namespace RDFDetail = ROOT::Detail::RDF;
 
+/// Throw if a column of type colTId (described by colKind, e.g. "defined") cannot be read as type tid
+void CheckReaderType(std::string_view readerName, const std::string &colName, std::string_view colKind,
+                     const std::type_info &colTId, const std::type_info &tid);
+
 void CheckDefineType(RDFDetail::RDefineBase &define, const std::type_info &tid);
 
 /// Column reader for defined (aka custom) columns.
@@ -43,6 +51,8 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
       return fCustomValuePtr;
    }
 
+   void *GetBulkImpl(const RMaskedEntryRange &mask) final { return fDefine.UpdateBulk(fSlot, mask); }
+
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define, const std::type_info &tid)
       : fDefine(define), fCustomValuePtr(define.GetValuePtr(slot)), fSlot(slot)
@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <typeinfo>
 #include <vector>
 
 namespace ROOT {
@@ -65,14 +67,20 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
 
 public:
    RFilter(FilterF f, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd,
-           const RDFInternal::RBookedDefines &defines, std::string_view name = "")
-      : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), defines),
+           const RDFInternal::RBookedDefines &defines, std::string_view name = "",
+           std::string_view variationName = "nominal")
+      : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), defines,
+                    variationName),
         fFilter(std::move(f)), fColumnNames(columns), fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr),
         fValues(fNSlots), fIsDefine()
    {
       const auto nColumns = fColumnNames.size();
-      for (auto i = 0u; i < nColumns; ++i)
+      for (auto i = 0u; i < nColumns; ++i) {
          fIsDefine[i] = fDefines.HasName(fColumnNames[i]);
+         // the varied clones of the input Defines must exist before the event loop, see GetVariedDefine
+         if (fIsDefine[i] && fVariation != "nominal")
+            fDefines.GetColumns().at(fColumnNames[i])->GetVariedDefine(fVariation);
+      }
    }
 
    RFilter(const RFilter &) = delete;
@@ -107,13 +115,53 @@ public:
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      auto &mask = fBulkMasks[slot];
+      if (!mask.IsRange(firstEntry, bulkSize)) {
+         // start from the entries that passed the upstream filters and evaluate this filter on them
+         mask = fPrevData.CheckFiltersBulk(slot, firstEntry, bulkSize);
+         if (mask.Any())
+            CheckFilterBulkHelper(slot, mask, ColumnTypes_t{}, TypeInd_t{});
+      }
+      return mask;
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, RDFInternal::RMaskedEntryRange &mask, TypeList<ColTypes...>,
+                              std::index_sequence<S...>)
+   {
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(mask)...};
+      const auto bulkSize = mask.Size();
+      ULong64_t nChecked = 0;
+      ULong64_t nAccepted = 0;
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!mask[i])
+            continue;
+         const bool passed = fFilter(std::get<S>(values)[i]...);
+         mask[i] = passed;
+         ++nChecked;
+         nAccepted += passed;
+      }
+      fAccepted[slot] += nAccepted;
+      fRejected[slot] += nChecked - nAccepted;
+      // silence "unused variable" warnings in gcc for filters without input columns
+      (void)values;
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       for (auto &bookedBranch : fDefines.GetColumns())
          bookedBranch.second->InitSlot(r, slot);
+      if (fVariation != "nominal") {
+         for (auto &variation : fDefines.GetVariations())
+            variation.second->InitSlot(r, slot);
+      }
       RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                                           fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDataSource(), fVariation};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+      fBulkMasks[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
@@ -158,11 +206,56 @@ public:
    {
       for (auto &column : fDefines.GetColumns())
          column.second->FinaliseSlot(slot);
+      if (fVariation != "nominal") {
+         for (auto &variation : fDefines.GetVariations())
+            variation.second->FinaliseSlot(slot);
+      }
 
       for (auto &v : fValues[slot])
          v.reset();
    }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      return RDFInternal::Union(fPrevData.GetVariations(), fDefines.GetVariationDeps(fColumnNames));
+   }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final
+   {
+      auto it = fVariedFilters.find(variationName);
+      if (it != fVariedFilters.end())
+         return it->second;
+
+      auto prevNode = fPrevDataPtr;
+      const auto prevVariations = fPrevData.GetVariations();
+      if (std::find(prevVariations.begin(), prevVariations.end(), variationName) != prevVariations.end())
+         prevNode = std::static_pointer_cast<PrevDataFrame>(fPrevData.GetVariedFilter(variationName));
+
+      // varied filters are anonymous so that they do not appear in cut-flow reports
+      auto variedFilter = std::make_shared<RFilter>(RDFInternal::CopyCallable(fFilter), fColumnNames,
+                                                    std::move(prevNode), fDefines, "", variationName);
+      variedFilter->SetExpressionId(fExpressionId);
+      fLoopManager->Book(variedFilter.get());
+      fVariedFilters[variationName] = variedFilter;
+      return variedFilter;
+   }
+
+   /// Compiled expressions are identified by their type and the code version, jitted expressions by their code.
+   std::string GetFingerprint() const final
+   {
+      const auto prevFingerprint = fPrevData.GetFingerprint();
+      if (prevFingerprint.empty())
+         return "";
+      const auto &codeVersion = fLoopManager->GetResultCacheCodeVersion();
+      const auto exprId =
+         fExpressionId.empty() ? RDFInternal::GetCompiledCodeId(typeid(FilterF), codeVersion) : fExpressionId;
+      const auto inputFingerprint = fDefines.GetFingerprint(fColumnNames, codeVersion);
+      if (exprId.empty() || inputFingerprint.empty())
+         return "";
+      return RDFInternal::MakeFingerprint("Filter " + exprId + " " + fVariation + " " + inputFingerprint + " " +
+                                          prevFingerprint);
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // Recursively call for the previous node.
@@ -16,6 +16,8 @@
 #include "RtypesCore.h"
 #include "TError.h" // R_ASSERT
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,14 +41,21 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks; ///< Per-slot result of the last CheckFiltersBulk() call
    const std::string fName;
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedDefines fDefines;
+   /// The universe in which this filter selects entries, "nominal" unless this is a varied clone of another filter.
+   const std::string fVariation;
+   /// Clones of this filter that select entries in the universes it depends on, created by GetVariedFilter.
+   std::map<std::string, std::shared_ptr<RNodeBase>> fVariedFilters;
+   /// Identifies the expression in the fingerprint of this filter: the code of jitted expressions, empty otherwise.
+   std::string fExpressionId;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
-               const RDFInternal::RBookedDefines &defines);
+               const RDFInternal::RBookedDefines &defines, std::string_view variationName = "nominal");
    RFilterBase &operator=(const RFilterBase &) = delete;
 
    virtual ~RFilterBase();
@@ -67,6 +76,8 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    virtual void InitNode();
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Set the string that identifies the expression of this filter in its fingerprint, see fExpressionId.
+   void SetExpressionId(const std::string &id) { fExpressionId = id; }
 };
 
 } // ns RDF
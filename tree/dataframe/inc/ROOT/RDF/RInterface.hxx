@@ -17,6 +17,7 @@
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
@@ -423,6 +424,110 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column.
+   /// \param[in] colName The name of the column for which varied values are provided.
+   /// \param[in] expression Callable that computes the varied values of the column. It must return a RVec with one
+   /// value per variation tag, of the same type as the column.
+   /// \param[in] inputColumns The names of the columns to be passed to the expression.
+   /// \param[in] variationTags The names of the single variations, e.g. `{"down", "up"}`.
+   /// \param[in] variationName The name of the systematic variation. It defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// Results that depend on the varied column, directly or through Filters and Defines, can be retrieved for each
+   /// variation with ROOT::RDF::Experimental::VariationsFor, with keys `"variationName:tag"`. All varied results are
+   /// produced in the same event loop as the nominal ones. The expression always receives the nominal values of its
+   /// input columns.
+   ///
+   /// An exception is thrown if the variation tags are empty or not unique, or if a variation with the same name has
+   /// already been registered in this branch of the computation graph.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto nominal_hx =
+   ///    df.Vary("pt", [](double pt) { return ROOT::RVecD{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"})
+   ///      .Filter([](double pt) { return pt > 10.; }, {"pt"})
+   ///      .Histo1D<double>("pt");
+   ///
+   /// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+   /// hx["nominal"].Draw();
+   /// hx["pt:down"].Draw("SAME");
+   /// hx["pt:up"].Draw("SAME");
+   /// ~~~
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F &&expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using F_t = typename std::decay<F>::type;
+      using RetType = typename TTraits::CallableTraits<F_t>::ret_type;
+      static_assert(RDFInternal::IsRVec_t<RetType>::value,
+                    "Error in `Vary`: the expression must return a RVec with one value per variation tag");
+      using VariedCol_t = typename RetType::value_type;
+      static_assert(std::is_default_constructible<VariedCol_t>::value,
+                    "Error in `Vary`: the type of the varied column is not default-constructible");
+      using ColTypes_t = typename TTraits::CallableTraits<F_t>::arg_types;
+
+      const std::string theVariationName = variationName.empty() ? std::string(colName) : std::string(variationName);
+      if (variationTags.empty())
+         throw std::logic_error("Vary: no variation tags were passed for variation \"" + theVariationName + "\".");
+      auto sortedTags = variationTags;
+      std::sort(sortedTags.begin(), sortedTags.end());
+      if (std::adjacent_find(sortedTags.begin(), sortedTags.end()) != sortedTags.end())
+         throw std::logic_error("Vary: the tags of variation \"" + theVariationName + "\" are not unique.");
+      for (const auto &variation : fDefines.GetVariations()) {
+         if (variation.second->GetVariationName() == theVariationName) {
+            throw std::logic_error("Vary: a variation with name \"" + theVariationName +
+                                   "\" has already been registered in this branch of the computation graph.");
+         }
+      }
+
+      const auto variedColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      constexpr auto nColumns = ColTypes_t::list_size;
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, inputColumns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      auto retTypeName = RDFInternal::TypeID2TypeName(typeid(VariedCol_t));
+      if (retTypeName.empty()) {
+         // The type is not known to the interpreter, see DefineImpl
+         const auto demangledType = RDFInternal::DemangleTypeIdName(typeid(VariedCol_t));
+         retTypeName = "CLING_UNKNOWN_TYPE_" + demangledType;
+      }
+
+      auto variation = std::make_shared<RDFDetail::RVariation<F_t>>(
+         variedColName, theVariationName, variationTags, retTypeName, std::forward<F>(expression), validColumnNames,
+         fLoopManager->GetNSlots(), fDefines, fLoopManager->GetDSValuePtrs(), fDataSource);
+
+      RDFInternal::RBookedDefines newCols(fDefines);
+      newCols.AddVariation(variation);
+
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+   // clang-format on
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for an existing column, with tags "0", "1", ..., "nVariations-1".
+   /// \param[in] colName The name of the column for which varied values are provided.
+   /// \param[in] expression Callable that computes the varied values of the column, see the first overload.
+   /// \param[in] inputColumns The names of the columns to be passed to the expression.
+   /// \param[in] nVariations The number of variations returned by the expression.
+   /// \param[in] variationName The name of the systematic variation. It defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are defined.
+   ///
+   /// Refer to the first overload of this method for the full documentation.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F &&expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      variationTags.reserve(nVariations);
+      for (std::size_t i = 0u; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+      return Vary(colName, std::forward<F>(expression), inputColumns, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns to disk, in a new TTree `treename` in file `filename`.
    /// \tparam ColumnTypes variadic list of branch/column types.
@@ -1976,6 +2081,64 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   /// \brief Sets the number of entries that the event loop processes at once
+   /// \param[in] bulkSize The number of consecutive entries per bulk, must be at least 1
+   ///
+   /// With a bulk size larger than 1 (the default), column values are read for a whole bulk of entries, each Filter
+   /// evaluates a selection mask for the bulk and Defines and actions loop over the selected entries. This removes
+   /// most of the per-entry overhead of the event loop for simple numeric analyses; typical values are 256 to 1024.
+   /// Results are the same as in entry-by-entry processing, and callbacks registered with OnPartialResult() are
+   /// still invoked every N entries.
+   /// The setting applies to all event loops of the RDataFrame, including the one that is already booked.
+   /// Bulk processing is only available for empty sources and data sources that support it (e.g. RNTupleDS):
+   /// for TTree inputs and other data sources, entries are processed one by one.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df(1000000);
+   /// df.SetBulkSize(512);
+   /// auto h = df.Define("x", "gRandom->Gaus()").Filter("x > 0").Histo1D("x");
+   /// ~~~
+   void SetBulkSize(std::size_t bulkSize) { fLoopManager->SetBulkSize(bulkSize); }
+
+   /// \brief Gets the number of entries that the event loop processes at once, see SetBulkSize()
+   std::size_t GetBulkSize() const { return fLoopManager->GetBulkSize(); }
+
+   /// \brief Store the results of the event loops in a ROOT file and retrieve them in later runs of the same analysis
+   /// \param[in] fileName The name of the cache file, which is created if needed. An empty name disables the cache.
+   /// \param[in] codeVersion A tag that identifies the version of the compiled code of the analysis. Results that
+   /// depend on compiled code are only cached if it is given.
+   ///
+   /// Each result is stored with a key computed from the fingerprint of the part of the computation graph that
+   /// produces it: the names, sizes and modification times of the input files, the expressions of Defines and Filters
+   /// upstream of the action, and the type and initial state of the result (e.g. the model of a histogram).
+   /// Before an event loop starts, the results found in the cache are retrieved and their actions are marked as run;
+   /// if all results are retrieved, the event loop is skipped altogether. The other results are computed and stored.
+   /// This allows to iterate on an analysis over large inputs without re-processing the parts that did not change.
+   ///
+   /// Only actions booked after this call are cached, and only results that inherit from TObject (e.g. histograms)
+   /// or that are arithmetic values (e.g. Count, Sum, Mean) are supported.
+   /// Only TTrees read from files and empty sources can be identified, other data sources are never cached.
+   /// Jitted expressions are identified by their code. Compiled code, i.e. compiled callables passed to Define, Filter,
+   /// Vary, Aggregate and Reduce, helpers passed to Book and objects passed to Fill, is identified by its type, which
+   /// stays the same when the code is edited and recompiled. Therefore, results that depend on compiled code are only
+   /// cached if a `codeVersion` is given, e.g. a version number or a commit hash of the analysis code, and the version
+   /// is part of their keys. The version must change whenever the compiled code changes, including the functions that
+   /// are called by jitted expressions.
+   /// Callbacks registered with OnPartialResult() are not invoked for results that are retrieved from the cache.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("events", "data_*.root");
+   /// df.SetResultCache("analysis_cache.root", "v1");
+   /// auto h = df.Filter("nMuon == 2").Histo1D({"h", "h", 100, 0., 100.}, "Muon_pt");
+   /// h->Draw(); // runs the event loop the first time, reads the histogram from the cache afterwards
+   /// ~~~
+   void SetResultCache(std::string_view fileName, std::string_view codeVersion = "")
+   {
+      fLoopManager->SetResultCache(fileName, codeVersion);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot
@@ -2040,6 +2203,7 @@ public:
       auto action = std::make_unique<Action_t>(
          Helper_t(std::move(aggregator), std::move(merger), accObjPtr, fLoopManager->GetNSlots()), validColumnNames,
          fProxiedPtr, fDefines);
+      action->SetDependsOnCompiledCode();
       fLoopManager->Book(action.get());
       return MakeResultPtr(accObjPtr, *fLoopManager, std::move(action));
    }
@@ -2123,6 +2287,7 @@ public:
 
       auto action = std::make_unique<Action_t>(Helper(std::forward<Helper>(helper)), validColumnNames, fProxiedPtr,
                                                fDefines);
+      action->SetDependsOnCompiledCode();
       fLoopManager->Book(action.get());
       return MakeResultPtr(resPtr, *fLoopManager, std::move(action));
    }
@@ -16,6 +16,8 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 class TTreeReader;
 
@@ -47,6 +49,7 @@ public:
    void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
 
    void Run(unsigned int slot, Long64_t entry) final;
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
@@ -60,6 +63,10 @@ public:
 
    // Helper for RMergeableValue
    std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> GetMergeableValue() const final;
+
+   std::vector<std::string> GetVariations() const final;
+   std::unique_ptr<RActionBase> MakeVariedAction(const std::string &variationName, void *newResult) final;
+   std::string GetFingerprint() const final;
 };
 
 } // ns RDF
@@ -38,13 +38,21 @@ public:
    {
    }
 
-   void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   void SetDefine(std::unique_ptr<RDefineBase> c)
+   {
+      c->SetExpressionId(fExpressionId);
+      fConcreteDefine = std::move(c);
+   }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask) final;
    void FinaliseSlot(unsigned int slot) final;
+   std::vector<std::string> GetVariations() const final;
+   RDefineBase &GetVariedDefine(const std::string &variationName) final;
+   std::string GetFingerprint(const std::string &codeVersion) const final;
 };
 
 } // ns RDF
@@ -37,7 +37,7 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// RJittedFilter is the type of the node returned by jitted Filter calls: the concrete filter can be created and set
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
-   std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   std::shared_ptr<RFilterBase> fConcreteFilter = nullptr;
 
 public:
    RJittedFilter(RLoopManager *lm, std::string_view name);
@@ -47,6 +47,8 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -58,6 +60,9 @@ public:
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinaliseSlot(unsigned int slot) final;
+   std::vector<std::string> GetVariations() const final;
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
+   std::string GetFingerprint() const final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
 };
 
@@ -11,12 +11,16 @@
 #ifndef ROOT_RLOOPMANAGER
 #define ROOT_RLOOPMANAGER
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RStringView.hxx"
 
+#include <cstddef> // std::size_t
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // forward declarations
@@ -77,6 +81,18 @@ class RLoopManager : public RNodeBase {
             fFun(slot);
          }
       }
+
+      /// Bulk version: account for nEntries processed entries at once, invoking the callback as many times as
+      /// the per-entry version would have.
+      void operator()(unsigned int slot, std::size_t nEntries)
+      {
+         auto &c = fCounters[slot];
+         c += nEntries;
+         while (c >= fEveryN) {
+            c -= fEveryN;
+            fFun(slot);
+         }
+      }
    };
 
    class TOneTimeCallback {
@@ -107,6 +123,10 @@ class RLoopManager : public RNodeBase {
    const ColumnNames_t fDefaultColumns;
    const ULong64_t fNEmptyEntries{0};
    const unsigned int fNSlots{1};
+   /// Number of entries processed at once in bulk mode, 1 (the default) means that entries are processed one by one
+   std::size_t fBulkSize{1};
+   /// Per-slot masks of the bulks processed in bulk mode, all entries selected: the starting point of all filters
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
    bool fMustRunNamedFilters{true};
    const ELoopType fLoopType; ///< The kind of event loop that is going to be run (e.g. on ROOT files, on no files)
    const std::unique_ptr<RDataSource> fDataSource; ///< Owning pointer to a data-source object. Null if no data-source
@@ -121,6 +141,13 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   /// Name of the file that stores the results of the event loops across processes, empty if the cache is disabled
+   std::string fResultCacheFile;
+   /// Identifies the compiled code of the analysis in the fingerprints, empty if results that depend on it are not cached
+   std::string fResultCacheCodeVersion;
+   /// Fingerprint of the input dataset, computed at the beginning of each event loop if the result cache is enabled
+   std::string fSourceFingerprint;
+
    void CheckIndexedFriends();
    void RunEmptySourceMT();
    void RunEmptySource();
@@ -129,11 +156,16 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize);
+   std::size_t GetEffectiveBulkSize() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(unsigned int slot);
    void EvalChildrenCounts();
+   std::string MakeSourceFingerprint() const;
+   std::vector<std::pair<RDFInternal::RActionBase *, std::string>> RestoreCachedResults();
+   void StoreCachedResults(const std::vector<std::pair<RDFInternal::RActionBase *, std::string>> &results);
 
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
@@ -158,7 +190,14 @@ public:
    void Book(RRangeBase *rangePtr);
    void Deregister(RRangeBase *rangePtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBulk(unsigned int slot, Long64_t firstEntry,
+                                                         std::size_t bulkSize) final;
    unsigned int GetNSlots() const { return fNSlots; }
+   void SetBulkSize(std::size_t bulkSize);
+   std::size_t GetBulkSize() const { return fBulkSize; }
+   void SetResultCache(std::string_view fileName, std::string_view codeVersion);
+   bool IsResultCacheEnabled() const { return !fResultCacheFile.empty(); }
+   const std::string &GetResultCacheCodeVersion() const { return fResultCacheCodeVersion; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final {}
@@ -176,6 +215,11 @@ public:
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
+   /// End of recursive chain of calls: all entries are selected in all universes
+   std::vector<std::string> GetVariations() const final { return {}; }
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
+   /// End of recursive chain of calls: the fingerprint of the input dataset, see MakeSourceFingerprint
+   std::string GetFingerprint() const final { return fSourceFingerprint; }
    /// For each booked filter, returns either the name or "Unnamed Filter"
    std::vector<std::string> GetFiltersNames();
 
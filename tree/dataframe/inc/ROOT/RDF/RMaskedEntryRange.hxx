@@ -0,0 +1,67 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_INTERNAL_RDF_RMASKEDENTRYRANGE
+#define ROOT_INTERNAL_RDF_RMASKEDENTRYRANGE
+
+#include <RtypesCore.h> // Long64_t
+
+#include <algorithm>
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RMaskedEntryRange
+\ingroup dataframe
+\brief A bulk of consecutive entries together with a mask that selects some of them
+
+In bulk mode, the event loop processes several consecutive entries at once. Filters narrow down the mask of the
+bulk, column readers and Defines only need to provide the values of the entries selected by the mask.
+The mask uses one char per entry rather than a std::vector<bool> so that loops over it can be vectorized.
+**/
+class RMaskedEntryRange {
+   std::vector<char> fMask;
+   Long64_t fFirstEntry = -1; ///< Entry number of the first entry of the bulk, -1 if the range is not set
+
+public:
+   RMaskedEntryRange() = default;
+
+   /// Sets the range to [firstEntry, firstEntry + size) with all entries selected or deselected.
+   /// Does not release the memory of the mask, so that resetting to a range of similar size does not allocate.
+   void Reset(Long64_t firstEntry, std::size_t size, bool selected)
+   {
+      fFirstEntry = firstEntry;
+      fMask.assign(size, selected);
+   }
+   /// Marks the range as unset, e.g. at the beginning of a task
+   void Invalidate() { fFirstEntry = -1; }
+
+   Long64_t FirstEntry() const { return fFirstEntry; }
+   std::size_t Size() const { return fMask.size(); }
+   /// Whether the range covers [firstEntry, firstEntry + size)
+   bool IsRange(Long64_t firstEntry, std::size_t size) const
+   {
+      return (fFirstEntry == firstEntry) && (fMask.size() == size);
+   }
+
+   char operator[](std::size_t idx) const { return fMask[idx]; }
+   char &operator[](std::size_t idx) { return fMask[idx]; }
+
+   bool Any() const { return std::find(fMask.begin(), fMask.end(), 1) != fMask.end(); }
+   std::size_t Count() const { return std::count(fMask.begin(), fMask.end(), 1); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,252 @@
+/// \file ROOT/RDF/RNTupleSnapshot.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNTUPLESNAPSHOT
+#define ROOT_RDF_RNTUPLESNAPSHOT
+
+#include <ROOT/RDF/ActionHelpers.hxx>
+#include <ROOT/RDF/RInterface.hxx>
+#include <ROOT/RDF/RLoopManager.hxx>
+#include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RIntegerSequence.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
+#include <ROOT/RResultPtr.hxx>
+#include <ROOT/RSnapshotOptions.hxx>
+#include <ROOT/RStringView.hxx>
+#include <TROOT.h> // IsImplicitMTEnabled
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Internal {
+
+/// Translate the options of a Snapshot into RNTuple write options.  Only the "RECREATE" mode is supported.
+RNTupleWriteOptions GetNTupleWriteOptions(const ROOT::RDF::RSnapshotOptions &options);
+
+/// Helper object for a single-thread SnapshotNTuple action
+template <typename... ColTypes>
+class SnapshotNTupleHelper : public ROOT::Detail::RDF::RActionImpl<SnapshotNTupleHelper<ColTypes...>> {
+public:
+   using Result_t = ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>;
+
+private:
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const std::vector<std::string> fOutputFieldNames;
+   const RNTupleWriteOptions fWriteOptions;
+   std::unique_ptr<RNTupleWriter> fWriter;
+   /// The values of the default entry of the writer's model, one per output field
+   std::tuple<std::shared_ptr<ColTypes>...> fValues;
+   /// The dataframe that reads the output ntuple, set when the event loop is over
+   std::shared_ptr<Result_t> fOutputDF;
+
+   template <std::size_t... S>
+   void MakeFields(RNTupleModel &model, std::index_sequence<S...>)
+   {
+      fValues = std::make_tuple(model.MakeField<ColTypes>(fOutputFieldNames[S])...);
+   }
+
+   template <std::size_t... S>
+   void SetValues(ColTypes &... values, std::index_sequence<S...>)
+   {
+      int expander[] = {(*std::get<S>(fValues) = values, 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+   }
+
+public:
+   SnapshotNTupleHelper(std::string_view filename, std::string_view ntupleName,
+                        const std::vector<std::string> &fieldNames, const RNTupleWriteOptions &writeOptions)
+      : fFileName(filename), fNTupleName(ntupleName),
+        fOutputFieldNames(ROOT::Internal::RDF::ReplaceDotWithUnderscore(fieldNames)), fWriteOptions(writeOptions),
+        fOutputDF(std::make_shared<Result_t>(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0)))
+   {
+   }
+   SnapshotNTupleHelper(const SnapshotNTupleHelper &) = delete;
+   SnapshotNTupleHelper(SnapshotNTupleHelper &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int /* slot */, ColTypes &... values)
+   {
+      SetValues(values..., std::index_sequence_for<ColTypes...>{});
+      fWriter->Fill();
+   }
+
+   void Initialize()
+   {
+      auto model = RNTupleModel::Create();
+      MakeFields(*model, std::index_sequence_for<ColTypes...>{});
+      fWriter = RNTupleWriter::Recreate(std::move(model), fNTupleName, fFileName, fWriteOptions);
+   }
+
+   void Finalize()
+   {
+      // commits the last cluster and the footer
+      fWriter.reset();
+      *fOutputDF = MakeNTupleDataFrame(fNTupleName, fFileName);
+   }
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fOutputDF; }
+
+   std::string GetActionName() { return "SnapshotNTuple"; }
+};
+
+/// Helper object for a multi-thread SnapshotNTuple action.  Every slot fills its own clusters through a fill context
+/// of a parallel writer; the sealed pages of the clusters go directly to the shared page sink.  As for the TTree
+/// Snapshot in multi-thread runs, the order of the entries in the output is not the one of the input.
+template <typename... ColTypes>
+class SnapshotNTupleHelperMT : public ROOT::Detail::RDF::RActionImpl<SnapshotNTupleHelperMT<ColTypes...>> {
+public:
+   using Result_t = ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>;
+
+private:
+   const unsigned int fNSlots;
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const std::vector<std::string> fOutputFieldNames;
+   const RNTupleWriteOptions fWriteOptions;
+   std::unique_ptr<RNTupleParallelWriter> fWriter;
+   /// Created by the first task of a slot, kept until the end of the event loop so that clusters span several tasks
+   std::vector<std::shared_ptr<RNTupleFillContext>> fFillContexts;
+   /// The values of the default entry of each fill context, one per output field
+   std::vector<std::tuple<ColTypes *...>> fValues;
+   /// The dataframe that reads the output ntuple, set when the event loop is over
+   std::shared_ptr<Result_t> fOutputDF;
+
+   template <std::size_t... S>
+   void MakeFields(RNTupleModel &model, std::index_sequence<S...>)
+   {
+      int expander[] = {(model.MakeField<ColTypes>(fOutputFieldNames[S]), 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+   }
+
+   template <std::size_t... S>
+   void GetValues(unsigned int slot, std::index_sequence<S...>)
+   {
+      auto *model = fFillContexts[slot]->GetModel();
+      fValues[slot] = std::make_tuple(model->Get<ColTypes>(fOutputFieldNames[S])...);
+   }
+
+   template <std::size_t... S>
+   void SetValues(unsigned int slot, ColTypes &... values, std::index_sequence<S...>)
+   {
+      auto &slotValues = fValues[slot];
+      int expander[] = {(*std::get<S>(slotValues) = values, 0)..., 0};
+      (void)expander; // avoid unused variable warnings for older compilers such as gcc 4.9
+      (void)slotValues;
+   }
+
+public:
+   SnapshotNTupleHelperMT(unsigned int nSlots, std::string_view filename, std::string_view ntupleName,
+                          const std::vector<std::string> &fieldNames, const RNTupleWriteOptions &writeOptions)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntupleName),
+        fOutputFieldNames(ROOT::Internal::RDF::ReplaceDotWithUnderscore(fieldNames)), fWriteOptions(writeOptions),
+        fFillContexts(fNSlots), fValues(fNSlots),
+        fOutputDF(std::make_shared<Result_t>(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0)))
+   {
+   }
+   SnapshotNTupleHelperMT(const SnapshotNTupleHelperMT &) = delete;
+   SnapshotNTupleHelperMT(SnapshotNTupleHelperMT &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fFillContexts[slot]) {
+         fFillContexts[slot] = fWriter->CreateFillContext();
+         GetValues(slot, std::index_sequence_for<ColTypes...>{});
+      }
+   }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      SetValues(slot, values..., std::index_sequence_for<ColTypes...>{});
+      fFillContexts[slot]->Fill();
+   }
+
+   void Initialize()
+   {
+      auto model = RNTupleModel::Create();
+      MakeFields(*model, std::index_sequence_for<ColTypes...>{});
+      fWriter = RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName, fWriteOptions);
+   }
+
+   void Finalize()
+   {
+      // the fill contexts commit their last clusters, then the writer commits the footer
+      fFillContexts.clear();
+      fWriter.reset();
+      *fOutputDF = MakeNTupleDataFrame(fNTupleName, fFileName);
+   }
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fOutputDF; }
+
+   std::string GetActionName() { return "SnapshotNTuple"; }
+};
+
+} // namespace Internal
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Save selected columns of a dataframe to disk, in a new RNTuple `ntupleName` in file `fileName`.
+/// \tparam ColumnTypes variadic list of column types.
+/// \param[in] df The node of the computation graph whose entries are written.
+/// \param[in] ntupleName The name of the output RNTuple.
+/// \param[in] fileName The name of the output file.
+/// \param[in] columnList The list of names of the columns to be written.
+/// \param[in] options RSnapshotOptions with the compression settings and the laziness of the action.
+/// \return a `RDataFrame` that wraps the snapshotted dataset.
+///
+/// This is the RNTuple counterpart of RInterface::Snapshot.  Dots in the column names are replaced by underscores
+/// in the field names.  Only the "RECREATE" mode is supported; fAutoFlush and fSplitLevel are ignored.
+/// With implicit multi-threading enabled, every processing slot fills its own clusters and hands them over to
+/// the page sink shared by all slots; the order of the entries is therefore not preserved.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// auto out = ROOT::Experimental::SnapshotNTuple<float, ROOT::RVec<float>>(df, "events", "out.root", {"pt", "jets"});
+/// ~~~
+template <typename... ColumnTypes, typename NodeType>
+ROOT::RDF::RResultPtr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>>
+SnapshotNTuple(NodeType df, std::string_view ntupleName, std::string_view fileName,
+               const std::vector<std::string> &columnList,
+               const ROOT::RDF::RSnapshotOptions &options = ROOT::RDF::RSnapshotOptions())
+{
+   const auto writeOptions = Internal::GetNTupleWriteOptions(options);
+
+   ROOT::RDF::RResultPtr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>> resPtr;
+   if (ROOT::IsImplicitMTEnabled()) {
+      using Helper_t = Internal::SnapshotNTupleHelperMT<ColumnTypes...>;
+      resPtr = df.template Book<ColumnTypes...>(
+         Helper_t(ROOT::Internal::RDF::GetNSlots(), fileName, ntupleName, columnList, writeOptions), columnList);
+   } else {
+      using Helper_t = Internal::SnapshotNTupleHelper<ColumnTypes...>;
+      resPtr = df.template Book<ColumnTypes...>(Helper_t(fileName, ntupleName, columnList, writeOptions), columnList);
+   }
+
+   if (!options.fLazy)
+      *resPtr;
+   return resPtr;
+}
+
+} // ns Experimental
+} // ns ROOT
+
+#endif
@@ -11,8 +11,10 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 #include <vector>
@@ -48,11 +50,24 @@ public:
    RNodeBase(RLoopManager *lm = nullptr) : fLoopManager(lm) {}
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk version of CheckFilters(): returns the mask of the entries in [firstEntry, firstEntry + bulkSize) that pass
+   /// all filters up to and including this node. The result is cached per slot until the next bulk.
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
    virtual void StopProcessing() = 0;
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Return the names of the universes that the entries selected by this node depend on (see RVariationBase).
+   virtual std::vector<std::string> GetVariations() const = 0;
+   /// Return the clone of this node that selects entries in the given universe, creating it on first request.
+   /// Must only be called for universes returned by GetVariations(), before the event loop starts.
+   virtual std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) = 0;
+   /// Return a digest of the selection performed by this node and by all nodes upstream of it, down to the data
+   /// source, that is stable across processes. It is part of the keys of the results in the result cache (see
+   /// RLoopManager::SetResultCache). An empty fingerprint means that the selected entries cannot be identified.
+   virtual std::string GetFingerprint() const = 0;
    // Helper function for SaveGraph
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> GetGraph() = 0;
 
@@ -13,9 +13,13 @@
 
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // MakeFingerprint
 #include "RtypesCore.h"
 
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -75,6 +79,31 @@ public:
       return fLastResult;
    }
 
+   const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      if (!fBulkMask.IsRange(firstEntry, bulkSize)) {
+         fBulkMask = fPrevData.CheckFiltersBulk(slot, firstEntry, bulkSize);
+         // the range logic depends on the number of entries seen so far, so the bulk is processed in order
+         for (std::size_t i = 0; i < bulkSize; ++i) {
+            if (!fBulkMask[i])
+               continue;
+            if (fHasStopped) {
+               fBulkMask[i] = false;
+               continue;
+            }
+            ++fNProcessedEntries;
+            fBulkMask[i] = !(fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
+                             (fStride != 1 && fNProcessedEntries % fStride != 0));
+            if (fNProcessedEntries == fStop) {
+               fHasStopped = true;
+               fPrevData.StopProcessing();
+            }
+         }
+      }
+      return fBulkMask;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevData.PartialReport(rep); }
@@ -98,6 +127,25 @@ public:
 
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+
+   std::vector<std::string> GetVariations() const final { return fPrevData.GetVariations(); }
+
+   /// The entries selected by a Range depend on all entries processed before, so it cannot be varied on its own
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final
+   {
+      throw std::logic_error("Cannot compute the results of systematic variation \"" + variationName +
+                             "\": Range is not supported downstream of a systematic variation.");
+   }
+
+   std::string GetFingerprint() const final
+   {
+      const auto prevFingerprint = fPrevData.GetFingerprint();
+      if (prevFingerprint.empty())
+         return "";
+      return RDFInternal::MakeFingerprint("Range " + std::to_string(fStart) + " " + std::to_string(fStop) + " " +
+                                          std::to_string(fStride) + " " + prevFingerprint);
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
@@ -36,6 +36,7 @@ protected:
    unsigned int fStride;
    Long64_t fLastCheckedEntry{-1};
    bool fLastResult{true};
+   ROOT::Internal::RDF::RMaskedEntryRange fBulkMask; ///< Result of the last CheckFiltersBulk() call
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
@@ -0,0 +1,128 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTCACHE
+#define ROOT_RDF_RRESULTCACHE
+
+#include "ROOT/RDF/Utils.hxx" // ResetDirectory
+#include "RtypesCore.h"
+#include "TDirectory.h"
+#include "TObject.h"
+#include "TParameter.h"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Type-erased access to the result of an action for the result cache (see RLoopManager::SetResultCache).
+/// The state of the result before the event loop, e.g. the model of a histogram or the initial value of a sum, is
+/// captured at construction: it is part of the key of the result in the cache.
+class RCachedResultBase {
+public:
+   virtual ~RCachedResultBase();
+   /// Return a string that identifies the state of the result before the event loop.
+   virtual const std::string &GetInitialState() const = 0;
+   /// Store the result in the directory with the given key.
+   virtual void Write(TDirectory &dir, const std::string &key) const = 0;
+   /// Overwrite the result with the one stored in the directory with the given key.
+   /// Return false if the directory does not contain such a result.
+   virtual bool Read(TDirectory &dir, const std::string &key) = 0;
+};
+
+/// Return a digest of the streamed content of the object.
+std::string GetObjectFingerprint(const TObject &obj);
+
+/// Return a string representation of the value that does not lose precision.
+std::string GetValueFingerprint(Double_t value);
+std::string GetValueFingerprint(Long64_t value);
+
+/// Results that inherit from TObject are stored as they are.
+template <typename T, bool IsObject = std::is_base_of<TObject, T>::value>
+class RCachedResult final : public RCachedResultBase {
+   std::shared_ptr<T> fResult;
+   const std::string fInitialState;
+
+public:
+   RCachedResult(const std::shared_ptr<T> &result) : fResult(result), fInitialState(GetObjectFingerprint(*result)) {}
+
+   const std::string &GetInitialState() const final { return fInitialState; }
+
+   void Write(TDirectory &dir, const std::string &key) const final
+   {
+      dir.WriteTObject(fResult.get(), key.c_str(), "Overwrite");
+   }
+
+   bool Read(TDirectory &dir, const std::string &key) final
+   {
+      std::unique_ptr<T> obj(dir.Get<T>(key.c_str()));
+      if (!obj)
+         return false;
+      *fResult = *obj;
+      ResetDirectory(*fResult, 0);
+      return true;
+   }
+};
+
+/// Arithmetic results are stored as TParameter<Double_t> or TParameter<Long64_t>.
+template <typename T>
+class RCachedResult<T, false> final : public RCachedResultBase {
+   using Stored_t = typename std::conditional<std::is_floating_point<T>::value, Double_t, Long64_t>::type;
+
+   std::shared_ptr<T> fResult;
+   const std::string fInitialState;
+
+public:
+   RCachedResult(const std::shared_ptr<T> &result)
+      : fResult(result), fInitialState(GetValueFingerprint(static_cast<Stored_t>(*result)))
+   {
+   }
+
+   const std::string &GetInitialState() const final { return fInitialState; }
+
+   void Write(TDirectory &dir, const std::string &key) const final
+   {
+      TParameter<Stored_t> par(key.c_str(), static_cast<Stored_t>(*fResult));
+      dir.WriteTObject(&par, key.c_str(), "Overwrite");
+   }
+
+   bool Read(TDirectory &dir, const std::string &key) final
+   {
+      std::unique_ptr<TParameter<Stored_t>> par(dir.Get<TParameter<Stored_t>>(key.c_str()));
+      if (!par)
+         return false;
+      *fResult = static_cast<T>(par->GetVal());
+      return true;
+   }
+};
+
+// this overload is SFINAE'd out for results that cannot be stored in the result cache
+template <typename T, typename std::enable_if<(std::is_base_of<TObject, T>::value &&
+                                               std::is_copy_assignable<T>::value) ||
+                                                 std::is_arithmetic<T>::value,
+                                              int>::type = 0>
+std::unique_ptr<RCachedResultBase> MakeCachedResult(const std::shared_ptr<T> &result, int)
+{
+   return std::unique_ptr<RCachedResultBase>(new RCachedResult<T>(result));
+}
+
+// results of all other types are not cached
+template <typename T>
+std::unique_ptr<RCachedResultBase> MakeCachedResult(const std::shared_ptr<T> &, long)
+{
+   return nullptr;
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTCACHE
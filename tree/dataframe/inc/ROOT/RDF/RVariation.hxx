@@ -0,0 +1,188 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATION
+#define ROOT_RDF_RVARIATION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <cstddef> // std::size_t
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+/// The node that computes the systematic variations of a column registered with Vary.
+/// F returns a RVec with one varied value of the column per variation tag.
+template <typename F>
+class R__CLING_PTRCHECK(off) RVariation final : public RVariationBase {
+   using ColumnTypes_t = typename CallableTraits<F>::arg_types;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename CallableTraits<F>::ret_type;
+   using VariedCol_t = typename ret_type::value_type;
+
+   /// The varied values of the current bulk of a slot and the entries they have been evaluated for.
+   /// fValues holds fCapacity values per tag, the ones of each tag being contiguous.
+   struct RBulkValues {
+      std::unique_ptr<VariedCol_t[]> fValues;
+      std::size_t fCapacity = 0;
+      RDFInternal::RMaskedEntryRange fEvaluated;
+      RDFInternal::RMaskedEntryRange fRequest; ///< Entries to be evaluated by the ongoing UpdateBulk() call
+   };
+
+   F fExpression;
+   const ColumnNames_t fColumnNames;
+   /// The varied values of the last entry processed by each slot, one per tag
+   std::vector<std::unique_ptr<VariedCol_t[]>> fLastResults;
+   std::vector<RBulkValues> fBulkValues;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   /// Move the values returned by the expression to dest, dest + stride, dest + 2 * stride...
+   void StoreResults(ret_type &&results, VariedCol_t *dest, std::size_t stride)
+   {
+      const auto nTags = fTags.size();
+      if (results.size() != nTags) {
+         throw std::runtime_error("The expression passed to Vary for column \"" + fColumnName + "\" returned " +
+                                  std::to_string(results.size()) + " values, but " + std::to_string(nTags) +
+                                  " were expected (one per variation tag).");
+      }
+      for (std::size_t i = 0; i < nTags; ++i)
+         dest[i * stride] = std::move(results[i]);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      StoreResults(fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...), fLastResults[slot].get(), 1);
+      // silence "unused parameter" warnings in gcc
+      (void)entry;
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, RBulkValues &bulk, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      const auto &request = bulk.fRequest;
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBulk<ColTypes>(request)...};
+      const auto bulkSize = request.Size();
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!request[i])
+            continue;
+         StoreResults(fExpression(std::get<S>(values)[i]...), bulk.fValues.get() + i, bulk.fCapacity);
+         bulk.fEvaluated[i] = true;
+      }
+      // silence "unused variable" warnings in gcc for expressions without input columns
+      (void)values;
+   }
+
+public:
+   RVariation(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+              std::string_view type, F expression, const ColumnNames_t &inputColumns, unsigned int nSlots,
+              const RDFInternal::RBookedDefines &defines, const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+              ROOT::RDF::RDataSource *ds)
+      : RVariationBase(columnName, variationName, tags, type, nSlots, defines, DSValuePtrs, ds),
+        fExpression(std::move(expression)), fColumnNames(inputColumns), fLastResults(fNSlots),
+        fBulkValues(fNSlots), fValues(fNSlots), fIsDefine()
+   {
+      for (auto &values : fLastResults)
+         values.reset(new VariedCol_t[fTags.size()]);
+      const auto nColumns = fColumnNames.size();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = fDefines.HasName(fColumnNames[i]);
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         // the inputs of the expression are always read with their nominal values
+         const std::string nominal = "nominal";
+         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs, fDataSource,
+                                              nominal};
+         fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fLastCheckedEntry[slot] = -1;
+         fBulkValues[slot].fEvaluated.Invalidate();
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot, std::size_t varIdx) final
+   {
+      return static_cast<void *>(&fLastResults[slot][varIdx]);
+   }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot]) {
+         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedEntry[slot] = entry;
+      }
+   }
+
+   void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t varIdx) final
+   {
+      auto &bulk = fBulkValues[slot];
+      const auto bulkSize = mask.Size();
+      if (!bulk.fEvaluated.IsRange(mask.FirstEntry(), bulkSize)) {
+         if (bulk.fCapacity < bulkSize) {
+            bulk.fValues.reset(new VariedCol_t[bulkSize * fTags.size()]);
+            bulk.fCapacity = bulkSize;
+         }
+         bulk.fEvaluated.Reset(mask.FirstEntry(), bulkSize, false);
+      }
+      // only evaluate the requested entries that have not been evaluated for an earlier request in this bulk
+      auto &request = bulk.fRequest;
+      request.Reset(mask.FirstEntry(), bulkSize, false);
+      bool mustEvaluate = false;
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         request[i] = mask[i] && !bulk.fEvaluated[i];
+         mustEvaluate |= request[i];
+      }
+      if (mustEvaluate)
+         UpdateBulkHelper(slot, bulk, ColumnTypes_t{}, TypeInd_t{});
+      return static_cast<void *>(bulk.fValues.get() + varIdx * bulk.fCapacity);
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(VariedCol_t); }
+
+   void FinaliseSlot(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         for (auto &v : fValues[slot])
+            v.reset();
+         fIsInitialized[slot] = false;
+      }
+   }
+};
+
+} // namespace RDF
+} // namespace Detail
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATION
@@ -0,0 +1,93 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONBASE
+#define ROOT_RDF_RVARIATIONBASE
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h" // Long64_t
+
+#include <cstddef> // std::size_t
+#include <deque>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+class RDataSource;
+}
+namespace Detail {
+namespace RDF {
+
+namespace RDFInternal = ROOT::Internal::RDF;
+
+/**
+\class ROOT::Detail::RDF::RVariationBase
+\ingroup dataframe
+\brief Type-erased base class of the nodes that hold the systematic variations of a column registered with Vary.
+
+A variation provides, for each entry, one alternative value of the varied column per variation tag.
+Each (variation name, tag) pair identifies a "universe", named `"variationName:tag"`: nodes of the computation graph
+that depend on the varied column are cloned once per universe, and the clones read the varied values instead of the
+nominal ones.
+**/
+class RVariationBase {
+protected:
+   const std::string fColumnName;        ///< The name of the varied column
+   const std::string fVariationName;     ///< The name of the systematic variation, e.g. "pt_scale"
+   const std::vector<std::string> fTags; ///< The tags of the single variations, e.g. {"up", "down"}
+   const std::string fType;              ///< The type of the varied column as a text string
+   const unsigned int fNSlots;           ///< Number of thread slots used by this node
+   std::vector<Long64_t> fLastCheckedEntry;
+   RDFInternal::RBookedDefines fDefines; ///< The Defines available to the expression that computes the variations
+   std::deque<bool> fIsInitialized;      // because vector<bool> is not thread-safe
+   const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   ROOT::RDF::RDataSource *fDataSource; ///< non-owning ptr to the RDataSource, if any. Used to retrieve column readers.
+
+public:
+   RVariationBase(std::string_view columnName, std::string_view variationName, const std::vector<std::string> &tags,
+                  std::string_view type, unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
+                  const std::map<std::string, std::vector<void *>> &DSValuePtrs, ROOT::RDF::RDataSource *ds);
+
+   RVariationBase(const RVariationBase &) = delete;
+   RVariationBase &operator=(const RVariationBase &) = delete;
+   virtual ~RVariationBase();
+
+   virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Return the (type-erased) address of the value of the varIdx-th variation for the given processing slot.
+   virtual void *GetValuePtr(unsigned int slot, std::size_t varIdx) = 0;
+   virtual const std::type_info &GetTypeId() const = 0;
+   /// Update the values of all variations at the addresses returned by GetValuePtr for the given entry
+   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Bulk version of Update(): evaluates the variations for the entries selected by the mask that have not been
+   /// evaluated yet and returns the (type-erased) address of the contiguous values of the varIdx-th variation.
+   virtual void *UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask, std::size_t varIdx) = 0;
+   /// Clean-up operations to be performed at the end of a task.
+   virtual void FinaliseSlot(unsigned int slot) = 0;
+
+   const std::string &GetColumnName() const { return fColumnName; }
+   const std::string &GetVariationName() const { return fVariationName; }
+   const std::vector<std::string> &GetTags() const { return fTags; }
+   std::string GetTypeName() const { return fType; }
+   /// Return the names of the universes of this variation, i.e. `"variationName:tag"` for each tag.
+   std::vector<std::string> GetVariationNames() const;
+   /// Return the index of the given universe in GetVariationNames(), or the number of tags if it is not one of ours.
+   std::size_t GetVariationIndex(const std::string &variationName) const;
+};
+
+} // namespace RDF
+} // namespace Detail
+} // namespace ROOT
+
+#endif // ROOT_RDF_RVARIATIONBASE
@@ -0,0 +1,63 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RVARIATIONREADER
+#define ROOT_RDF_RVARIATIONREADER
+
+#include "RColumnReaderBase.hxx"
+#include "RDefineReader.hxx" // CheckReaderType
+#include "RVariationBase.hxx"
+#include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
+
+#include <cstddef> // std::size_t
+#include <limits>
+#include <typeinfo>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+
+/// Column reader for the values of a column in one of the universes of a systematic variation.
+class R__CLING_PTRCHECK(off) RVariationReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Non-owning reference to the node responsible for the variations of the column.
+   RDFDetail::RVariationBase &fVariation;
+
+   /// Non-owning ptr to the varied value of the column.
+   void *fValuePtr = nullptr;
+
+   /// The slot this value belongs to.
+   unsigned int fSlot = std::numeric_limits<unsigned int>::max();
+
+   /// The index of the universe this reader reads in the tags of fVariation.
+   std::size_t fVariationIdx;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      fVariation.Update(fSlot, entry);
+      return fValuePtr;
+   }
+
+   void *GetBulkImpl(const RMaskedEntryRange &mask) final { return fVariation.UpdateBulk(fSlot, mask, fVariationIdx); }
+
+public:
+   RVariationReader(unsigned int slot, RDFDetail::RVariationBase &variation, std::size_t variationIdx,
+                    const std::type_info &tid)
+      : fVariation(variation), fValuePtr(variation.GetValuePtr(slot, variationIdx)), fSlot(slot),
+        fVariationIdx(variationIdx)
+   {
+      CheckReaderType("RVariationReader", variation.GetColumnName(), "varied", variation.GetTypeId(), tid);
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
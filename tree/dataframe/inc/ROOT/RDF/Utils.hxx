@@ -21,10 +21,12 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <type_traits> // std::decay
 #include <vector>
 
+class TDirectory;
 class TTree;
 class TTreeReader;
 
@@ -189,6 +191,45 @@ void Erase(const T &that, std::vector<T> &v)
    v.erase(std::remove(v.begin(), v.end(), that), v.end());
 }
 
+/// Return a copy of the callable of a node, to be used by the clone of the node in a varied universe.
+template <typename F, typename std::enable_if<std::is_copy_constructible<F>::value, int>::type = 0>
+F CopyCallable(const F &f)
+{
+   return f;
+}
+
+// this overload is chosen for callables that cannot be copied, which do not support systematic variations
+template <typename F, typename std::enable_if<!std::is_copy_constructible<F>::value, int>::type = 0>
+F CopyCallable(const F &)
+{
+   throw std::logic_error("RDataFrame: a callable that is not copy-constructible was passed to a Filter or Define "
+                          "that depends on a systematic variation. Varied results need a copy of the callable.");
+}
+
+// this overload is SFINAE'd out if T does not implement `SetDirectory`
+template <typename T>
+auto ResetDirectory(T &obj, int) -> decltype(obj.SetDirectory(static_cast<TDirectory *>(nullptr)), void())
+{
+   // results that are copied or read back by RDataFrame must not be registered to the current directory
+   obj.SetDirectory(nullptr);
+}
+
+// this one is always available but has lower precedence thanks to `long`
+template <typename T>
+void ResetDirectory(T &, long)
+{
+}
+
+/// Return the union of the two collections of names, sorted and without duplicates
+std::vector<std::string> Union(const std::vector<std::string> &v1, const std::vector<std::string> &v2);
+
+/// Return a hash of the given description of a node of the computation graph, used to identify cached results
+std::string MakeFingerprint(const std::string &description);
+
+/// Return the identifier of compiled code of the given type in the fingerprints, or an empty string if no code version
+/// is given: the type alone does not change when the code is edited and recompiled (see RLoopManager::SetResultCache)
+std::string GetCompiledCodeId(const std::type_info &type, const std::string &codeVersion);
+
 /// Declare code in the interpreter via the TInterpreter::Declare method, throw in case of errors
 void InterpreterDeclare(const std::string &code);
 
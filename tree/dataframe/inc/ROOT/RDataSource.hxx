@@ -189,6 +189,15 @@ public:
    // clang-format on
    virtual bool SetEntry(unsigned int slot, ULong64_t entry) = 0;
 
+   // clang-format off
+   /// \brief Whether the column readers returned by GetColumnReaders(slot, name, tid) support bulk reading.
+   /// In bulk mode (see RInterface::SetBulkSize), the event loop asks column readers for the values of several
+   /// consecutive entries at once. The data source must then override RColumnReaderBase::GetBulkImpl.
+   /// SetEntry is only called for the first entry of each bulk and its return value is ignored.
+   /// Bulks never cross the boundaries of the entry ranges returned by GetEntryRanges.
+   // clang-format on
+   virtual bool SupportsBulkReading() const { return false; }
+
    // clang-format off
    /// \brief Convenience method called before starting an event-loop.
    /// This method might be called multiple times over the lifetime of a RDataSource, since
@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -35,25 +36,81 @@ class RNTupleDescriptor;
 namespace Detail {
 class RFieldBase;
 class RFieldValue;
+class RNTupleColumnReader;
 class RPageSource;
 
 } // namespace Detail
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first source, one for each slot
-   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
+   friend class Detail::RNTupleColumnReader;
+
+   /// A chain element.  Files are attached on demand, first when their entry ranges are computed and then by the
+   /// slots that process them.  Entry numbers are global, i.e. they continue across file boundaries.
+   struct RFileInfo {
+      /// Empty if the data source was constructed from a single page source
+      std::string fFileName;
+      NTupleSize_t fFirstEntry = 0;
+      NTupleSize_t fNEntries = 0;
+      /// Attached page source used to compute the entry ranges; handed over to the first slot that reaches the file.
+      /// A page source given by the user is kept as a prototype and cloned for every slot.
+      std::unique_ptr<Detail::RPageSource> fSource;
+   };
+
+   /// The page source that a slot currently reads from, together with the global entry range of its file
+   struct RSlotInfo {
+      /// Shared with the column readers, which keep the page source alive until they reconnect
+      std::shared_ptr<Detail::RPageSource> fSource;
+      NTupleSize_t fFirstEntry = 0;
+      NTupleSize_t fLastEntry = 0;
+      /// Incremented whenever fSource changes, so that the column readers of the slot reconnect their fields
+      std::uint64_t fGeneration = 0;
+      /// The page sources opened by the slot in the current event loop, indexed by file; released by Finalise()
+      std::vector<std::shared_ptr<Detail::RPageSource>> fFileSources;
+   };
+
+   std::string fNTupleName;
+   std::vector<RFileInfo> fFiles;
+   /// Protects the hand-over of the page sources in fFiles to the slots
+   std::mutex fLockFiles;
+   /// The files before fNextFile have their entry ranges computed in the current event loop
+   std::size_t fNextFile = 0;
+   std::vector<RSlotInfo> fSlots;
 
    std::vector<std::string> fColumnNames;
    std::vector<std::string> fColumnTypes;
    std::vector<size_t> fActiveColumns;
 
+   /// Top-level fields and value ranges of the page statistics based pre-selection, see AddRangeFilter().  The
+   /// field names are resolved to column ids separately for every file.
+   struct RRangeFilter {
+      std::string fFieldName;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RRangeFilter> fRangeFilters;
+
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
-   void AddFields(const RNTupleDescriptor &desc, DescriptorId_t parentId);
+   /// Throws if the fields of the given file differ in name, order, or type from the fields of the first file
+   void CheckSchema(std::size_t fileIndex, const RNTupleDescriptor &descriptor) const;
+   /// Attaches the page source of the given file if it is not yet attached and computes its entry count
+   Detail::RPageSource &AttachFile(std::size_t fileIndex);
+   /// Returns an attached page source for the given file to be owned by a slot
+   std::unique_ptr<Detail::RPageSource> OpenFileForSlot(std::size_t fileIndex);
+   /// The cluster-aligned entry ranges of the file that pass the range filters, in global entry numbers
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetFileEntryRanges(std::size_t fileIndex);
 
 public:
+   /// Minimum number of entry ranges per slot handed out by a single call to GetEntryRanges(), unless there are no
+   /// more files.  Small files are thus combined into one batch of ranges while large files are not opened before
+   /// they are needed.
+   static constexpr unsigned int kMinRangesPerSlot = 4;
+
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Chains the ntuples of the given name in the given files, like a TChain.  All ntuples need to have the
+   /// same schema, which is taken from the first file.
+   RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames);
    ~RNTupleDS() = default;
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
@@ -61,7 +118,13 @@ public:
    std::string GetTypeName(std::string_view colName) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
 
+   /// Skips the clusters and pages whose statistics rule out values of the given top-level field in [min, max].
+   /// For collection fields, the range refers to the collection size.  The data source does not filter individual
+   /// entries, i.e. the corresponding Filter() is still required in the computation graph.
+   void AddRangeFilter(std::string_view fieldName, double min, double max);
+
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsBulkReading() const final { return true; }
 
    void Initialise() final;
    void Finalise() final;
@@ -73,7 +136,9 @@ protected:
    Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
 };
 
+/// The file name may contain wildcards in its last path component, which are expanded like in TChain::Add()
 RDataFrame MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName);
+RDataFrame MakeNTupleDataFrame(std::string_view ntupleName, const std::vector<std::string> &fileNames);
 
 } // ns Experimental
 } // ns ROOT
@@ -0,0 +1,126 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTMAP
+#define ROOT_RDF_RRESULTMAP
+
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
+#include "ROOT/RDF/Utils.hxx" // ResetDirectory
+#include "ROOT/RResultPtr.hxx"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief A container for the results of an action in the nominal case and in each universe of its systematic variations.
+
+RResultMap objects are returned by VariationsFor. The results are accessed by name: `"nominal"` for the result without
+variations and `"variationName:tag"` for each universe the action depends on (see RInterface::Vary).
+As for RResultPtr, accessing a result that is not ready triggers the event loop.
+**/
+template <typename T>
+class RResultMap {
+   std::vector<std::string> fKeys; ///< "nominal" followed by the names of the universes, sorted
+   std::unordered_map<std::string, std::shared_ptr<T>> fMap;
+   /// The actions that fill the results, one per key. The nominal one is shared with the original RResultPtr.
+   std::unordered_map<std::string, std::shared_ptr<ROOT::Internal::RDF::RActionBase>> fActions;
+   ROOT::Detail::RDF::RLoopManager *fLoopManager; ///< Non-owning pointer to the RLoopManager the actions are booked to
+
+   friend RResultMap VariationsFor<T>(RResultPtr<T> resPtr);
+
+   RResultMap(ROOT::Detail::RDF::RLoopManager *lm) : fLoopManager(lm) {}
+
+public:
+   /// Return the result for the given key, triggering the event loop if it has not run yet.
+   /// Throw a std::runtime_error if there is no result for the key.
+   T &operator[](const std::string &key)
+   {
+      auto it = fMap.find(key);
+      if (it == fMap.end())
+         throw std::runtime_error("RResultMap: no result with key \"" + key + "\".");
+      if (!fActions[key]->HasRun())
+         fLoopManager->Run();
+      return *it->second;
+   }
+
+   /// Return the keys of the results: "nominal" first, then the names of the universes.
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Produce all required systematic variations for the given result.
+/// \param[in] resPtr The nominal result, returned by an action of RDataFrame.
+/// \return A RResultMap with the nominal result and one varied result per universe the action depends on.
+///
+/// For each universe, the action that produces resPtr and the part of the computation graph upstream of it that depends
+/// on the varied columns are cloned and booked: all results are filled by the same event loop.
+/// VariationsFor must be called before the event loop that fills resPtr runs.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// auto nominal_hx =
+///    df.Vary("pt", [](double pt) { return ROOT::RVecD{pt * 0.9, pt * 1.1}; }, {"pt"}, {"down", "up"}, "ptvar")
+///      .Filter("pt > k")
+///      .Define("x", someFunc)
+///      .Histo1D<float>("x");
+///
+/// auto hx = ROOT::RDF::Experimental::VariationsFor(nominal_hx);
+/// hx["nominal"].Draw();
+/// hx["ptvar:down"].Draw("SAME");
+/// ~~~
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   R__ASSERT(resPtr != nullptr && "Calling VariationsFor on an empty RResultPtr");
+
+   if (resPtr.IsReady()) {
+      throw std::logic_error("VariationsFor: the event loop that fills this result has already run. VariationsFor must "
+                             "be called before the results are accessed.");
+   }
+
+   auto *lm = resPtr.fLoopManager;
+   // the nominal action might be jitted: the universes it depends on are only known after jitting
+   lm->Jit();
+
+   RResultMap<T> map(lm);
+   map.fKeys.emplace_back("nominal");
+   map.fMap.emplace("nominal", resPtr.fObjPtr);
+   map.fActions.emplace("nominal", resPtr.fActionPtr);
+
+   for (const auto &variation : resPtr.fActionPtr->GetVariations()) {
+      auto variedResult = std::make_shared<T>(*resPtr.fObjPtr);
+      ROOT::Internal::RDF::ResetDirectory(*variedResult, 0);
+      std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction =
+         resPtr.fActionPtr->MakeVariedAction(variation, &variedResult);
+      if (lm->IsResultCacheEnabled())
+         variedAction->SetCachedResult(ROOT::Internal::RDF::MakeCachedResult(variedResult, 0));
+      lm->Book(variedAction.get());
+      map.fKeys.emplace_back(variation);
+      map.fMap.emplace(variation, std::move(variedResult));
+      map.fActions.emplace(variation, std::move(variedAction));
+   }
+
+   return map;
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTMAP
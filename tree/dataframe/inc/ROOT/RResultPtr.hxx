@@ -14,6 +14,7 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "RtypesCore.h"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "TError.h" // Warning
 
@@ -33,6 +34,15 @@ namespace RDF {
 // Fwd decl for MakeResultPtr
 template <typename T>
 class RResultPtr;
+
+namespace Experimental {
+// Fwd decl for VariationsFor
+template <typename T>
+class RResultMap;
+
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr);
+} // namespace Experimental
 } // namespace RDF
 
 namespace Detail {
@@ -100,6 +110,7 @@ class RResultPtr {
    template <class T1>
    friend bool operator!=(std::nullptr_t lhs, const RResultPtr<T1> &rhs);
    friend std::unique_ptr<RDFDetail::RMergeableValue<T>> RDFDetail::GetMergeableValue<T>(RResultPtr<T> &rptr);
+   friend ROOT::RDF::Experimental::RResultMap<T> ROOT::RDF::Experimental::VariationsFor<T>(RResultPtr<T> resPtr);
 
    friend class ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper;
 
@@ -366,10 +377,13 @@ namespace Detail {
 namespace RDF {
 /// Create a RResultPtr and set its pointer to the corresponding RAction
 /// This overload is invoked by non-jitted actions, as they have access to RAction before constructing RResultPtr.
+/// If the result cache is enabled, the result is registered with the action so that it can be stored and retrieved.
 template <typename T>
 RResultPtr<T>
 MakeResultPtr(const std::shared_ptr<T> &r, RLoopManager &lm, std::shared_ptr<RDFInternal::RActionBase> actionPtr)
 {
+   if (lm.IsResultCacheEnabled())
+      actionPtr->SetCachedResult(RDFInternal::MakeCachedResult(r, 0));
    return RResultPtr<T>(r, &lm, std::move(actionPtr));
 }
 
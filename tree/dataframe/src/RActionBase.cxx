@@ -10,11 +10,20 @@
 
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 
 using namespace ROOT::Internal::RDF;
 
-RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines)
-   : fLoopManager(lm), fNSlots(lm->GetNSlots()), fColumnNames(colNames), fDefines(defines) { }
+RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines,
+                         const std::string &variationName)
+   : fLoopManager(lm), fNSlots(lm->GetNSlots()), fColumnNames(colNames), fDefines(defines), fVariation(variationName)
+{
+}
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() {}
+
+void RActionBase::SetCachedResult(std::unique_ptr<RCachedResultBase> cachedResult)
+{
+   fCachedResult = std::move(cachedResult);
+}
@@ -20,8 +20,17 @@ A RDataFrame that adapts an arrow::Table class can be constructed using the fact
 ROOT::RDF::MakeArrowDataFrame, which accepts one parameter:
 1. An arrow::Table smart pointer.
 
+Record batches can also be streamed, so that the dataset is never entirely in memory:
+ROOT::RDF::MakeArrowDataFrame also accepts an arrow::RecordBatchReader, whose batches
+can be read in a single event loop, and ROOT::RDF::MakeArrowIPCDataFrame reads the
+record batches of a file in the Arrow IPC file format. Batches are read at each call
+to GetEntryRanges, together with the following ones until each slot has enough entries
+to process, and released once they have been processed.
+
 The types of the columns are derived from the types in the associated
-arrow::Schema.
+arrow::Schema. Values of numerical columns are read in place from the Arrow buffers,
+and list columns of numerical types are exposed as RVecs that are views over the Arrow
+buffers: no data is copied. Boolean and string values are unpacked into a per-slot copy.
 
 */
 // clang-format on
@@ -33,6 +42,7 @@ arrow::Schema.
 #include <snprintf.h>
 
 #include <algorithm>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -41,6 +51,9 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -95,6 +108,8 @@ private:
    /// The entry in the array which should be looked up.
    ULong64_t fCurrentEntry;
 
+   /// Point the cached RVec to the values of the entry in the Arrow buffer: the RVec adopts the memory, nothing is
+   /// copied.
    template <typename T>
    void *getTypeErasedPtrFrom(arrow::ListArray const &array, int32_t entry, RVec<T> &cache)
    {
@@ -104,8 +119,7 @@ private:
       auto offset = array.value_offset(entry);
       // Here the cast to void* is a worksround while we figure out the
       // issues we have with long long types, signed and unsigned.
-      RVec<T> tmp(reinterpret_cast<T *>((void *)values->raw_values()) + offset, array.value_length(entry));
-      std::swap(cache, tmp);
+      cache = RVec<T>(reinterpret_cast<T *>((void *)values->raw_values()) + offset, array.value_length(entry));
       return (void *)(&cache);
    }
 
@@ -215,19 +229,31 @@ private:
    arrow::ArrayVector fChunks;
 
 public:
-   TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+   TValueGetter(size_t slots)
+      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0)
+   {
+      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
+         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
+      }
+   }
+
+   /// Set the arrays of the record batches that are being processed, the first of which starts at firstEntry.
+   /// The arrays of the previous batches are released.
+   void SetChunks(arrow::ArrayVector chunks, ULong64_t firstEntry)
    {
+      fChunks = std::move(chunks);
+      fFirstEntryPerChunk.clear();
+      fChunkIndex.clear();
       fChunkIndex.reserve(fChunks.size());
-      size_t next = 0;
-      for (auto &chunk : chunks) {
+      ULong64_t next = firstEntry;
+      for (auto &chunk : fChunks) {
          fFirstEntryPerChunk.push_back(next);
          next += chunk->length();
          fChunkIndex.push_back(next);
       }
-      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
-         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
-      }
+      // the next SetEntry of each slot must look the entry up in the new chunks
+      std::fill(fLastEntryPerSlot.begin(), fLastEntryPerSlot.end(), std::numeric_limits<ULong64_t>::max());
+      std::fill(fLastChunkPerSlot.begin(), fLastChunkPerSlot.end(), 0);
    }
 
    /// This returns the ptr to the ptr to actual data.
@@ -240,6 +266,12 @@ public:
       return result;
    }
 
+   /// Whether the entry belongs to the record batches that are being processed
+   bool HasEntry(ULong64_t entry) const
+   {
+      return !fChunkIndex.empty() && entry >= fFirstEntryPerChunk.front() && entry < fChunkIndex.back();
+   }
+
    // Convenience method to avoid code duplication between
    // SetEntry and InitSlot
    void UncachedSlotLookup(unsigned int slot, ULong64_t entry)
@@ -286,6 +318,30 @@ public:
    }
 };
 
+/// Sequential reading of the record batches of an Arrow IPC file.
+class RIPCFileBatchReader final : public arrow::RecordBatchReader {
+private:
+   std::shared_ptr<arrow::ipc::RecordBatchFileReader> fFileReader;
+   int fNextBatch = 0;
+
+public:
+   RIPCFileBatchReader(std::shared_ptr<arrow::ipc::RecordBatchFileReader> fileReader)
+      : fFileReader(std::move(fileReader))
+   {
+   }
+
+   std::shared_ptr<arrow::Schema> schema() const final { return fFileReader->schema(); }
+
+   arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) final
+   {
+      if (fNextBatch == fFileReader->num_record_batches()) {
+         batch->reset();
+         return arrow::Status::OK();
+      }
+      return fFileReader->ReadRecordBatch(fNextBatch++, batch);
+   }
+};
+
 } // namespace RDF
 } // namespace Internal
 
@@ -386,72 +442,94 @@ public:
 /// \param[in] inColumns the name of the columns to use
 /// In case columns is empty, we use all the columns found in the table
 RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::string> const &inColumns)
-   : fTable{inTable}, fColumnNames{inColumns}
+   : fSchema{inTable->schema()}, fTable{inTable}, fColumnNames{inColumns}
 {
-   auto &columnNames = fColumnNames;
-   auto &table = fTable;
-   auto &index = fGetterIndex;
-   // We want to allow people to specify which columns they
-   // need so that we can think of upfront IO optimizations.
-   auto filterWantedColumns = [&columnNames, &table]() {
-      if (columnNames.empty()) {
-         for (auto &field : table->schema()->fields()) {
-            columnNames.push_back(field->name());
-         }
-      }
-   };
+   SetupColumns();
 
    // To support both arrow 0.14.0 and 0.16.0
    using ColumnType = decltype(fTable->column(0));
 
-   auto getRecordsFirstColumn = [&columnNames, &table]() {
-      if (columnNames.empty()) {
-         throw std::runtime_error("At least one column required");
-      }
-      const auto name = columnNames.front();
-      const auto columnIdx = table->schema()->GetFieldIndex(name);
-      return table->column(columnIdx)->length();
+   auto getRecordsFirstColumn = [this]() {
+      const auto columnIdx = fSchema->GetFieldIndex(fColumnNames.front());
+      return fTable->column(columnIdx)->length();
    };
 
    // All columns are supposed to have the same number of entries.
-   auto verifyColumnSize = [&table](ColumnType column, int columnIdx, int nRecords) {
+   auto verifyColumnSize = [this](ColumnType column, int columnIdx, int nRecords) {
       if (column->length() != nRecords) {
          std::string msg = "Column ";
-         msg += table->schema()->field(columnIdx)->name() + " has a different number of entries.";
+         msg += fSchema->field(columnIdx)->name() + " has a different number of entries.";
          throw std::runtime_error(msg);
       }
    };
 
-   /// For the moment we support only a few native types.
-   auto verifyColumnType = [&table](ColumnType column, int columnIdx) {
-      auto verifyType = std::make_unique<VerifyValidColumnType>();
-      auto result = column->type()->Accept(verifyType.get());
-      if (result.ok() == false) {
-         std::string msg = "Column ";
-         msg += table->schema()->field(columnIdx)->name() + " contains an unsupported type.";
-         throw std::runtime_error(msg);
-      }
-   };
+   auto nRecords = getRecordsFirstColumn();
+   for (auto &link : fGetterIndex)
+      verifyColumnSize(fTable->column(link.first), link.first, nRecords);
+}
 
-   /// This is used to create an index between the columnId
-   /// and the associated getter.
-   auto addColumnToGetterIndex = [&index](int columnId) { index.push_back(std::make_pair(columnId, index.size())); };
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource for RDataFrame that streams record batches.
+/// \param[in] batchReader the source of the record batches. They can be read only once, i.e. in a single event loop.
+/// \param[in] inColumns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the schema of the batches
+RArrowDS::RArrowDS(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &inColumns)
+   : fSchema{batchReader->schema()}, fBatchReader{batchReader}, fColumnNames{inColumns}
+{
+   SetupColumns();
+}
 
-   /// Assuming we can get called more than once, we need to
-   /// reset the getter index each time.
-   auto resetGetterIndex = [&index]() { index.clear(); };
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource for RDataFrame that streams the record batches of an Arrow IPC file.
+/// \param[in] fileName the name of a file in the Arrow IPC file format.
+/// \param[in] inColumns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the file
+RArrowDS::RArrowDS(std::string_view fileName, std::vector<std::string> const &inColumns) : fColumnNames{inColumns}
+{
+   const std::string fileNameStr(fileName);
+   std::shared_ptr<arrow::io::ReadableFile> file;
+   auto status = arrow::io::ReadableFile::Open(fileNameStr, &file);
+   if (status.ok())
+      status = arrow::ipc::RecordBatchFileReader::Open(file, &fFileReader);
+   if (!status.ok())
+      throw std::runtime_error("Could not open Arrow IPC file " + fileNameStr + ": " + status.ToString());
+   fSchema = fFileReader->schema();
+   SetupColumns();
+}
 
-   /// This is what initialization actually does
-   filterWantedColumns();
-   resetGetterIndex();
-   auto nRecords = getRecordsFirstColumn();
+/// Select all the columns of the schema if none was requested, check that the requested ones exist and are of a
+/// supported type, and build the index between the columns and their value getters.
+void RArrowDS::SetupColumns()
+{
+   // We want to allow people to specify which columns they
+   // need so that we can think of upfront IO optimizations.
+   if (fColumnNames.empty()) {
+      for (auto &field : fSchema->fields()) {
+         fColumnNames.push_back(field->name());
+      }
+   }
+   if (fColumnNames.empty()) {
+      throw std::runtime_error("At least one column required");
+   }
+
+   fGetterIndex.clear();
    for (auto &columnName : fColumnNames) {
-      auto columnIdx = fTable->schema()->GetFieldIndex(columnName);
-      addColumnToGetterIndex(columnIdx);
+      const auto columnIdx = fSchema->GetFieldIndex(columnName);
+      if (columnIdx == -1)
+         throw std::runtime_error("The dataset does not have column " + columnName);
 
-      auto column = fTable->column(columnIdx);
-      verifyColumnSize(column, columnIdx, nRecords);
-      verifyColumnType(column, columnIdx);
+      /// For the moment we support only a few native types.
+      VerifyValidColumnType verifyType;
+      auto result = fSchema->field(columnIdx)->type()->Accept(&verifyType);
+      if (result.ok() == false) {
+         std::string msg = "Column ";
+         msg += columnName + " contains an unsupported type.";
+         throw std::runtime_error(msg);
+      }
+
+      /// This is used to create an index between the columnId
+      /// and the associated getter.
+      fGetterIndex.push_back(std::make_pair(columnIdx, fGetterIndex.size()));
    }
 }
 
@@ -466,15 +544,62 @@ const std::vector<std::string> &RArrowDS::GetColumnNames() const
    return fColumnNames;
 }
 
+void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, ULong64_t firstEntry, ULong64_t nRecords,
+                        unsigned int nSlots)
+{
+   ranges.clear();
+   const auto chunkSize = nRecords / nSlots;
+   const auto remainder = 1U == nSlots ? 0 : nRecords % nSlots;
+   auto start = firstEntry;
+   auto end = firstEntry;
+   for (auto i : ROOT::TSeqU(nSlots)) {
+      start = end;
+      end += chunkSize;
+      ranges.emplace_back(start, end);
+      (void)i;
+   }
+   ranges.back().second += remainder;
+}
+
+/// Read the next record batches, until each slot has at least kMinEntriesPerSlot entries to process or the batches
+/// are exhausted, and split them in one entry range per slot. The batches read at the previous call are released.
 std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::GetEntryRanges()
 {
-   auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+   // Small batches are grouped to limit the overhead of each call to GetEntryRanges
+   constexpr ULong64_t kMinEntriesPerSlot = 64 * 1024;
+
+   const auto nColumns = fGetterIndex.size();
+   std::vector<arrow::ArrayVector> chunksPerColumn(nColumns);
+   ULong64_t nEntries = 0ULL;
+   std::shared_ptr<arrow::RecordBatch> batch;
+   while (nEntries < kMinEntriesPerSlot * fNSlots) {
+      auto status = fBatchReader->ReadNext(&batch);
+      if (!status.ok())
+         throw std::runtime_error("Could not read the next Arrow record batch: " + status.ToString());
+      if (!batch) // no more batches
+         break;
+      for (size_t ci = 0; ci != nColumns; ++ci)
+         chunksPerColumn[ci].push_back(batch->column(fGetterIndex[ci].first));
+      nEntries += batch->num_rows();
+   }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   if (nEntries == 0ULL) {
+      for (auto &getter : fValueGetters)
+         getter->SetChunks({}, fNextEntry);
+      return entryRanges;
+   }
+
+   for (size_t ci = 0; ci != nColumns; ++ci)
+      fValueGetters[fGetterIndex[ci].second]->SetChunks(std::move(chunksPerColumn[ci]), fNextEntry);
+   splitInEqualRanges(entryRanges, fNextEntry, nEntries, fNSlots);
+   fNextEntry += nEntries;
    return entryRanges;
 }
 
 std::string RArrowDS::GetTypeName(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       std::string msg = "The dataset does not have column ";
       msg += colName;
@@ -492,7 +617,7 @@ std::string RArrowDS::GetTypeName(std::string_view colName) const
 
 bool RArrowDS::HasColumn(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       return false;
    }
@@ -510,47 +635,15 @@ bool RArrowDS::SetEntry(unsigned int slot, ULong64_t entry)
 
 void RArrowDS::InitSlot(unsigned int slot, ULong64_t entry)
 {
+   // The single-thread event loop initialises slot 0 at entry 0 for each group of record batches: entries that are not
+   // part of the current batches are looked up at the first SetEntry instead.
    for (auto link : fGetterIndex) {
       auto &getter = fValueGetters[link.second];
-      getter->UncachedSlotLookup(slot, entry);
+      if (getter->HasEntry(entry))
+         getter->UncachedSlotLookup(slot, entry);
    }
 }
 
-void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, int nRecords, unsigned int nSlots)
-{
-   ranges.clear();
-   const auto chunkSize = nRecords / nSlots;
-   const auto remainder = 1U == nSlots ? 0 : nRecords % nSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(nSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
-   }
-   ranges.back().second += remainder;
-}
-
-int getNRecords(std::shared_ptr<arrow::Table> &table, std::vector<std::string> &columnNames)
-{
-   auto index = table->schema()->GetFieldIndex(columnNames.front());
-   return table->column(index)->length();
-};
-
-template <typename T>
-std::shared_ptr<arrow::ChunkedArray> getData(T p)
-{
-   return p->data();
-}
-
-template <>
-std::shared_ptr<arrow::ChunkedArray>
-getData<std::shared_ptr<arrow::ChunkedArray>>(std::shared_ptr<arrow::ChunkedArray> p)
-{
-   return p;
-}
-
 void RArrowDS::SetNSlots(unsigned int nSlots)
 {
    assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
@@ -558,10 +651,10 @@ void RArrowDS::SetNSlots(unsigned int nSlots)
    // We dump all the previous getters structures and we rebuild it.
    auto nColumns = fGetterIndex.size();
 
+   // Their chunks are set at each call to GetEntryRanges.
    fValueGetters.clear();
    for (size_t ci = 0; ci != nColumns; ++ci) {
-      auto chunkedArray = getData(fTable->column(fGetterIndex[ci].first));
-      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, chunkedArray->chunks()));
+      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots));
    }
 }
 
@@ -579,17 +672,36 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
       throw std::runtime_error("No column found at index " + std::to_string(column));
    };
 
-   const int columnIdx = fTable->schema()->GetFieldIndex(std::string(colName));
+   const int columnIdx = fSchema->GetFieldIndex(std::string(colName));
    const int getterIdx = findGetterIndex(columnIdx);
    assert(getterIdx != -1);
    assert((unsigned int)getterIdx < fValueGetters.size());
    return fValueGetters[getterIdx]->SlotPtrs();
 }
 
+/// Start reading the record batches from the beginning: tables and IPC files can be read in several event loops, the
+/// batches of a RecordBatchReader passed by the user only in one.
 void RArrowDS::Initialise()
 {
-   auto nRecords = getNRecords(fTable, fColumnNames);
-   splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
+   if (fTable) {
+      fBatchReader = std::make_shared<arrow::TableBatchReader>(*fTable);
+   } else if (fFileReader) {
+      fBatchReader = std::make_shared<ROOT::Internal::RDF::RIPCFileBatchReader>(fFileReader);
+   } else if (fBatchReaderConsumed) {
+      throw std::runtime_error("The record batches of an arrow::RecordBatchReader can be read only once, but a "
+                               "second event loop was started. Use an arrow::Table or an Arrow IPC file instead.");
+   }
+   fBatchReaderConsumed = !fTable && !fFileReader;
+   fNextEntry = 0ULL;
+}
+
+/// Release the record batches of the event loop, and the reader of a table or of an IPC file.
+void RArrowDS::Finalise()
+{
+   for (auto &getter : fValueGetters)
+      getter->SetChunks({}, 0ULL);
+   if (fTable || fFileReader)
+      fBatchReader.reset();
 }
 
 std::string RArrowDS::GetLabel()
@@ -607,6 +719,27 @@ RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<s
    return tdf;
 }
 
+/// Creates a RDataFrame that streams the record batches of an arrow::RecordBatchReader.
+/// \param[in] batchReader the source of the record batches. They can be read only once, i.e. in a single event loop.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the schema of the batches
+RDataFrame
+MakeArrowDataFrame(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(batchReader, columnNames));
+   return tdf;
+}
+
+/// Creates a RDataFrame that streams the record batches of a file in the Arrow IPC file format.
+/// \param[in] fileName the name of the file.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the file
+RDataFrame MakeArrowIPCDataFrame(std::string_view fileName, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(fileName, columnNames));
+   return tdf;
+}
+
 } // namespace RDF
 
 } // namespace ROOT
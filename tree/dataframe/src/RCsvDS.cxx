@@ -65,9 +65,11 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+RCsvDS reads the CSV file in chunks of lines: by default, each chunk spans about 16 MB of the file per
+processing slot, and only the current chunk is held in memory. Alternatively, the number of lines per
+chunk can be passed to the constructor. The lines of a chunk are split in one entry range per slot, and
+each range is parsed by the slot that processes it: with implicit multi-threading enabled, the lines
+are parsed in parallel.
 */
 // clang-format on
 
@@ -79,10 +81,87 @@ important to check both how much memory is available and the size of the CSV fil
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdlib> // std::strtod, std::strtoll
+#include <cstring> // std::memchr
 #include <iostream>
-#include <sstream>
 #include <string>
 
+namespace {
+
+/// The size of the chunks read from the file per processing slot, unless a number of lines per chunk is specified
+constexpr std::size_t kChunkBytesPerSlot = 16 * 1024 * 1024;
+
+/// Call f(fieldBegin, fieldSize) for each field of the line in [begin, end).
+/// Fields without quotes are passed in place; quoted fields are unescaped into scratch, as one quote is kept for
+/// escaped quotes ("") and none for the normal quotes.
+template <typename F>
+void ForEachField(const char *begin, const char *end, char delimiter, std::string &scratch, F &&f)
+{
+   const char *p = begin;
+   while (p < end) {
+      const char *fieldEnd = p;
+      while (fieldEnd < end && *fieldEnd != delimiter && *fieldEnd != '"')
+         ++fieldEnd;
+      if (fieldEnd == end || *fieldEnd == delimiter) {
+         f(p, static_cast<std::size_t>(fieldEnd - p));
+         p = fieldEnd + 1;
+         continue;
+      }
+
+      scratch.assign(p, fieldEnd);
+      bool quoted = false;
+      for (p = fieldEnd; p < end; ++p) {
+         if (*p == delimiter && !quoted) {
+            break;
+         } else if (*p == '"') {
+            if (p + 1 == end || p[1] != '"') {
+               quoted = !quoted;
+            } else {
+               scratch += *(++p);
+            }
+         } else {
+            scratch += *p;
+         }
+      }
+      f(scratch.data(), scratch.size());
+      ++p;
+   }
+}
+
+/// Copy the field into a null-terminated buffer on the stack, as required by strtod and strtoll, and convert it.
+template <typename T, typename Converter>
+T ConvertField(const char *field, std::size_t size, Converter convert, const char *typeName)
+{
+   char buf[64];
+   std::string longField; // numbers do not need more than 63 characters unless they are padded
+   const char *str = buf;
+   if (size < sizeof(buf)) {
+      std::copy(field, field + size, buf);
+      buf[size] = '\0';
+   } else {
+      longField.assign(field, size);
+      str = longField.c_str();
+   }
+   char *strEnd = nullptr;
+   const T value = convert(str, &strEnd);
+   if (strEnd == str)
+      throw std::runtime_error("RCsvDS: could not convert field \"" + std::string(field, size) + "\" to " + typeName);
+   return value;
+}
+
+double ParseDouble(const char *field, std::size_t size)
+{
+   return ConvertField<double>(field, size, [](const char *s, char **e) { return std::strtod(s, e); }, "double");
+}
+
+Long64_t ParseLong64(const char *field, std::size_t size)
+{
+   return ConvertField<Long64_t>(field, size, [](const char *s, char **e) { return std::strtoll(s, e, 10); },
+                                 "Long64_t");
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -111,41 +190,6 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
-{
-   std::istringstream lineStream(line);
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
-
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
-
-      switch (colType) {
-      case 'd': {
-         record.emplace_back(new double(std::stod(col)));
-         break;
-      }
-      case 'l': {
-         record.emplace_back(new Long64_t(std::stoll(col)));
-         break;
-      }
-      case 'b': {
-         auto b = new bool();
-         record.emplace_back(b);
-         std::istringstream is(col);
-         is >> std::boolalpha >> *b;
-         break;
-      }
-      case 's': {
-         record.emplace_back(new std::string(col));
-         break;
-      }
-      }
-      ++i;
-   }
-}
-
 void RCsvDS::GenerateHeaders(size_t size)
 {
    for (size_t i = 0; i < size; ++i) {
@@ -168,20 +212,10 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
 
    const auto &colNames = GetColumnNames();
    const auto index = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
+   // the addresses are set by SetEntry to the values of the entry in the parsed range of the slot
    std::vector<void *> ret(fNSlots);
-   for (auto slot : ROOT::TSeqU(fNSlots)) {
-      auto &val = fColAddresses[index][slot];
-      if (ti == typeid(double)) {
-         val = &fDoubleEvtValues[index][slot];
-      } else if (ti == typeid(Long64_t)) {
-         val = &fLong64EvtValues[index][slot];
-      } else if (ti == typeid(std::string)) {
-         val = &fStringEvtValues[index][slot];
-      } else {
-         val = &fBoolEvtValues[index][slot];
-      }
-      ret[slot] = &val;
-   }
+   for (auto slot : ROOT::TSeqU(fNSlots))
+      ret[slot] = &fColAddresses[index][slot];
    return ret;
 }
 
@@ -219,37 +253,103 @@ void RCsvDS::InferType(const std::string &col, unsigned int idxCol)
 std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
 {
    std::vector<std::string> columns;
-
-   for (size_t i = 0; i < line.size(); ++i) {
-      i = ParseValue(line, columns, i);
-   }
-
+   std::string scratch;
+   ForEachField(line.data(), line.data() + line.size(), fDelimiter, scratch,
+                [&columns](const char *field, std::size_t size) { columns.emplace_back(field, size); });
    return columns;
 }
 
-size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
+/// Read the next chunk of lines into fChunk and record the boundaries of its non-empty lines in fLines.
+/// A chunk ends at a line boundary: the bytes of a partial line at its end are read again with the next chunk.
+void RCsvDS::ReadChunk()
 {
-   std::stringstream val;
-   bool quoted = false;
-
-   for (; i < line.size(); ++i) {
-      if (line[i] == fDelimiter && !quoted) {
-         break;
-      } else if (line[i] == '"') {
-         // Keep just one quote for escaped quotes, none for the normal quotes
-         if (line[i + 1] != '"') {
-            quoted = !quoted;
+   fChunk.clear();
+   fLines.clear();
+   const std::size_t maxBytes = fNSlots * kChunkBytesPerSlot;
+
+   std::size_t lineBegin = 0; // the beginning of the first line of fChunk that has not been recorded yet
+   bool eof = false;
+   while ((fLinesChunkSize == -1LL && lineBegin < maxBytes) ||
+          (fLinesChunkSize != -1LL && fLines.size() < static_cast<std::size_t>(fLinesChunkSize))) {
+      auto lineEnd = static_cast<const char *>(std::memchr(&fChunk[lineBegin], '\n', fChunk.size() - lineBegin));
+      if (lineEnd == nullptr) {
+         if (eof) {
+            // the last line of the file does not need to end with a line break
+            if (lineBegin < fChunk.size())
+               lineEnd = fChunk.data() + fChunk.size();
+            else
+               break;
          } else {
-            val << line[++i];
+            // read a whole chunk at once, then small blocks up to the end of its last line
+            const std::size_t readBytes =
+               fChunk.empty() && fLinesChunkSize == -1LL ? maxBytes : std::size_t(64 * 1024);
+            const auto oldSize = fChunk.size();
+            fChunk.resize(oldSize + readBytes);
+            const auto nRead = fCsvFile->ReadAt(&fChunk[oldSize], readBytes, fChunkPos + oldSize);
+            fChunk.resize(oldSize + nRead);
+            eof = nRead < readBytes;
+            continue;
          }
-      } else {
-         val << line[i];
       }
+
+      const auto end = static_cast<std::size_t>(lineEnd - fChunk.data());
+      auto lineSize = end - lineBegin;
+      if (lineSize > 0 && fChunk[end - 1] == '\r') // Windows line breaks
+         --lineSize;
+      if (lineSize > 0) // skip empty lines
+         fLines.emplace_back(lineBegin, lineBegin + lineSize);
+      lineBegin = std::min(end + 1, fChunk.size());
    }
 
-   columns.emplace_back(val.str());
+   fChunkPos += lineBegin;
+}
+
+/// Parse the lines of the entry range of the current chunk that contains the entry into the parsed range of the slot.
+/// This is called by the slot that processes the range, so that different ranges are parsed concurrently.
+void RCsvDS::ParseRange(unsigned int slot, ULong64_t entry)
+{
+   const auto rangeIt = std::find_if(fEntryRanges.begin(), fEntryRanges.end(),
+                                     [entry](const std::pair<ULong64_t, ULong64_t> &r) { return entry < r.second; });
+   if (rangeIt == fEntryRanges.end() || entry < rangeIt->first) {
+      throw std::runtime_error("RCsvDS: entry " + std::to_string(entry) +
+                               " is not part of the entry ranges of the current chunk of the CSV file.");
+   }
+
+   auto &parsed = fParsedRanges[slot];
+   const auto nColumns = fHeaders.size();
+   parsed.fFirstEntry = rangeIt->first;
+   parsed.fNEntries = rangeIt->second - rangeIt->first;
+   for (auto col = 0u; col < nColumns; ++col) {
+      switch (fColTypesList[col]) {
+      case 'd': parsed.fDoubles[col].resize(parsed.fNEntries); break;
+      case 'l': parsed.fLong64s[col].resize(parsed.fNEntries); break;
+      case 'b': parsed.fBools[col].resize(parsed.fNEntries); break;
+      case 's': parsed.fStrings[col].resize(parsed.fNEntries); break;
+      }
+   }
 
-   return i;
+   const auto firstLine = parsed.fFirstEntry - (fProcessedLines - fLines.size());
+   for (auto i = 0ULL; i < parsed.fNEntries; ++i) {
+      const auto &line = fLines[firstLine + i];
+      auto col = 0u;
+      ForEachField(&fChunk[line.first], &fChunk[line.first] + (line.second - line.first), fDelimiter, parsed.fScratch,
+                   [&](const char *field, std::size_t size) {
+                      if (col < nColumns) {
+                         switch (fColTypesList[col]) {
+                         case 'd': parsed.fDoubles[col][i] = ParseDouble(field, size); break;
+                         case 'l': parsed.fLong64s[col][i] = ParseLong64(field, size); break;
+                         case 'b': parsed.fBools[col][i] = size == 4 && std::equal(field, field + 4, "true"); break;
+                         case 's': parsed.fStrings[col][i].assign(field, size); break;
+                         }
+                      }
+                      ++col;
+                   });
+      if (col < nColumns) {
+         throw std::runtime_error("RCsvDS: the record of entry " + std::to_string(parsed.fFirstEntry + i) + " has " +
+                                  std::to_string(col) + " fields, but the CSV file has " + std::to_string(nColumns) +
+                                  " columns.");
+      }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -258,6 +358,8 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
 /// \param[in] readHeaders `true` if the CSV file contains headers as first row, `false` otherwise
 ///                        (default `true`).
 /// \param[in] delimiter Delimiter character (default ',').
+/// \param[in] linesChunkSize Number of lines read from the file at a time, -1 (the default) to read chunks of
+///                           about 16 MB per processing slot.
 RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize) // TODO: Let users specify types?
    : fReadHeaders(readHeaders),
      fCsvFile(ROOT::Internal::RRawFile::Create(fileName)),
@@ -278,6 +380,7 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 
    fDataPos = fCsvFile->GetFilePos();
+   fChunkPos = fDataPos;
    bool eof = false;
    do {
       eof = !fCsvFile->Readln(line);
@@ -304,31 +407,21 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
 
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'd': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'l': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'b': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 's': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
+   fChunk.clear();
+   fChunk.shrink_to_fit();
+   fLines.clear();
+   fEntryRanges.clear();
+   for (auto &parsed : fParsedRanges) {
+      parsed.fNEntries = 0ULL;
+      for (auto &values : parsed.fDoubles)
+         std::vector<double>().swap(values);
+      for (auto &values : parsed.fLong64s)
+         std::vector<Long64_t>().swap(values);
+      for (auto &values : parsed.fStrings)
+         std::vector<std::string>().swap(values);
+      for (auto &values : parsed.fBools)
+         std::deque<bool>().swap(values);
    }
-   fRecords.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -340,7 +433,7 @@ RCsvDS::~RCsvDS()
 
 void RCsvDS::Finalise()
 {
-   fCsvFile->Seek(fDataPos);
+   fChunkPos = fDataPos;
    fProcessedLines = 0ULL;
    fEntryRangesRequested = 0ULL;
    FreeRecords();
@@ -351,51 +444,45 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
    return fHeaders;
 }
 
+/// Read the next chunk of lines and split it in one entry range per slot.
+/// The lines of each range are parsed by the slot that processes it, on the first call to SetEntry.
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
-
-   // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
-   FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
+   ReadChunk();
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Read chunk of %zu bytes of CSV file into memory, %zu lines read", fChunk.size(),
+              fLines.size());
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fLines.size());
       }
    }
 
-   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
+   fEntryRanges.clear();
+   for (auto &parsed : fParsedRanges)
+      parsed.fNEntries = 0ULL;
+   const auto nRecords = fLines.size();
    if (0 == nRecords)
-      return entryRanges;
+      return fEntryRanges;
 
    const auto chunkSize = nRecords / fNSlots;
    const auto remainder = 1U == fNSlots ? 0 : nRecords % fNSlots;
-   auto start = 0ULL == fEntryRangesRequested ? 0ULL : fProcessedLines;
+   auto start = fProcessedLines;
    auto end = start;
 
    for (auto i : ROOT::TSeqU(fNSlots)) {
       start = end;
       end += chunkSize;
-      entryRanges.emplace_back(start, end);
+      fEntryRanges.emplace_back(start, end);
       (void)i;
    }
-   entryRanges.back().second += remainder;
+   fEntryRanges.back().second += remainder;
 
    fProcessedLines += nRecords;
    fEntryRangesRequested++;
 
-   return entryRanges;
+   return fEntryRanges;
 }
 
 RCsvDS::ColType_t RCsvDS::GetType(std::string_view colName) const
@@ -421,31 +508,20 @@ bool RCsvDS::HasColumn(std::string_view colName) const
 
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
-   int colIndex = 0;
-   for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
-      switch (colType) {
-      case 'd': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
-         break;
+   auto &parsed = fParsedRanges[slot];
+   if (entry < parsed.fFirstEntry || entry >= parsed.fFirstEntry + parsed.fNEntries)
+      ParseRange(slot, entry);
+
+   const auto idx = entry - parsed.fFirstEntry;
+   const auto nColumns = fColTypesList.size();
+   for (auto colIndex = 0u; colIndex < nColumns; ++colIndex) {
+      auto &address = fColAddresses[colIndex][slot];
+      switch (fColTypesList[colIndex]) {
+      case 'd': address = &parsed.fDoubles[colIndex][idx]; break;
+      case 'l': address = &parsed.fLong64s[colIndex][idx]; break;
+      case 'b': address = &parsed.fBools[colIndex][idx]; break;
+      case 's': address = &parsed.fStrings[colIndex][idx]; break;
       }
-      case 'l': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
-         break;
-      }
-      case 'b': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
-         break;
-      }
-      case 's': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
-         break;
-      }
-      }
-      colIndex++;
    }
    return true;
 }
@@ -460,11 +536,14 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    // Initialise the entire set of addresses
    fColAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
 
-   // Initialize the per event data holders
-   fDoubleEvtValues.resize(nColumns, std::vector<double>(fNSlots));
-   fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
-   fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
-   fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+   // Initialize the per slot data holders
+   fParsedRanges.resize(fNSlots);
+   for (auto &parsed : fParsedRanges) {
+      parsed.fDoubles.resize(nColumns);
+      parsed.fLong64s.resize(nColumns);
+      parsed.fStrings.resize(nColumns);
+      parsed.fBools.resize(nColumns);
+   }
 }
 
 std::string RCsvDS::GetLabel()
@@ -1,4 +1,9 @@
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // GetCompiledCodeId, Union
+
+#include <typeinfo>
 
 namespace ROOT {
 namespace Internal {
@@ -26,6 +31,68 @@ void RBookedDefines::AddName(std::string_view name)
    fDefinesNames = newColsNames;
 }
 
+void RBookedDefines::AddVariation(const std::shared_ptr<RDFDetail::RVariationBase> &variation)
+{
+   auto newVariations = std::make_shared<RVariationsMap_t>(GetVariations());
+   newVariations->insert({variation->GetColumnName(), variation});
+   fVariations = newVariations;
+}
+
+RDFDetail::RVariationBase *
+RBookedDefines::FindVariation(const std::string &colName, const std::string &variationName) const
+{
+   const auto range = fVariations->equal_range(colName);
+   for (auto it = range.first; it != range.second; ++it) {
+      auto &variation = *it->second;
+      if (variation.GetVariationIndex(variationName) < variation.GetTags().size())
+         return &variation;
+   }
+   return nullptr;
+}
+
+RBookedDefines::ColumnNames_t RBookedDefines::GetVariationDeps(const ColumnNames_t &columns) const
+{
+   ColumnNames_t deps;
+   for (const auto &colName : columns) {
+      const auto range = fVariations->equal_range(colName);
+      for (auto it = range.first; it != range.second; ++it)
+         deps = Union(deps, it->second->GetVariationNames());
+      const auto defineIt = fDefines->find(colName);
+      if (defineIt != fDefines->end())
+         deps = Union(deps, defineIt->second->GetVariations());
+   }
+   return deps;
+}
+
+std::string RBookedDefines::GetFingerprint(const ColumnNames_t &columns, const std::string &codeVersion) const
+{
+   // never empty on success, also without input columns
+   std::string fingerprint = "Columns ";
+   for (const auto &colName : columns) {
+      fingerprint += colName + "=";
+      const auto defineIt = fDefines->find(colName);
+      if (defineIt != fDefines->end()) {
+         const auto defineFingerprint = defineIt->second->GetFingerprint(codeVersion);
+         if (defineFingerprint.empty())
+            return "";
+         fingerprint += defineFingerprint;
+      }
+      const auto range = fVariations->equal_range(colName);
+      for (auto it = range.first; it != range.second; ++it) {
+         // variations are always compiled, they are identified like compiled Defines
+         const auto &variation = *it->second;
+         const auto variationId = GetCompiledCodeId(typeid(variation), codeVersion);
+         if (variationId.empty())
+            return "";
+         fingerprint += " varied by " + variationId;
+         for (const auto &name : variation.GetVariationNames())
+            fingerprint += " " + name;
+      }
+      fingerprint += ";";
+   }
+   return fingerprint;
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
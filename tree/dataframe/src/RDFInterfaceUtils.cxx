@@ -558,6 +558,8 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   jittedFilter->SetExpressionId(std::string(expression));
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RBookedDefines *definesOnHeap = new ROOT::Internal::RDF::RBookedDefines(customCols);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
@@ -606,6 +608,7 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    auto definesCopy = new RDFInternal::RBookedDefines(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm.GetNSlots(), lm.GetDSValuePtrs());
+   jittedDefine->SetExpressionId(std::string(expression));
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper(" << lambdaName << ", {";
@@ -23,9 +23,11 @@
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -310,6 +312,33 @@ std::vector<std::string> ReplaceDotWithUnderscore(const std::vector<std::string>
    return newColNames;
 }
 
+/// Return the union of the two collections of names, sorted and without duplicates.
+std::vector<std::string> Union(const std::vector<std::string> &v1, const std::vector<std::string> &v2)
+{
+   std::vector<std::string> res = v1;
+   res.insert(res.end(), v2.begin(), v2.end());
+   std::sort(res.begin(), res.end());
+   res.erase(std::unique(res.begin(), res.end()), res.end());
+   return res;
+}
+
+/// Return the MD5 digest of the description as a hexadecimal string. Unlike std::hash, it is stable across processes,
+/// which is required to find the results of a computation graph in the result cache of a previous run.
+std::string MakeFingerprint(const std::string &description)
+{
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(description.data()), description.size());
+   md5.Final();
+   return md5.AsString();
+}
+
+std::string GetCompiledCodeId(const std::type_info &type, const std::string &codeVersion)
+{
+   if (codeVersion.empty())
+      return "";
+   return std::string(type.name()) + " version " + codeVersion;
+}
+
 void InterpreterDeclare(const std::string &code)
 {
    R__LOG_DEBUG(10, RDFLogChannel()) << "Declaring the following code to cling:\n\n" << code << '\n';
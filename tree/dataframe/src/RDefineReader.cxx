@@ -17,10 +17,10 @@
 #include <string>
 #include <typeinfo>
 
-void ROOT::Internal::RDF::CheckDefineType(RDefineBase &define, const std::type_info &tid)
+void ROOT::Internal::RDF::CheckReaderType(std::string_view readerName, const std::string &colName,
+                                          std::string_view colKind, const std::type_info &colTId,
+                                          const std::type_info &tid)
 {
-   const auto &colTId = define.GetTypeId();
-
    // Here we compare names and not typeinfos since they may come from two different contexts: a compiled
    // and a jitted one.
    const auto diffTypes = (0 != std::strcmp(colTId.name(), tid.name()));
@@ -32,14 +32,16 @@ void ROOT::Internal::RDF::CheckDefineType(RDefineBase &define, const std::type_i
    if (diffTypes && !inheritedType()) {
       const auto tName = TypeID2TypeName(tid);
       const auto colTypeName = TypeID2TypeName(colTId);
-      std::string errMsg = "RDefineReader: column \"" + define.GetName() + "\" is being used as ";
+      std::string errMsg = std::string(readerName) + ": column \"" + colName + "\" is being used as ";
       if (tName.empty()) {
          errMsg += tid.name();
          errMsg += " (extracted from type info)";
       } else {
          errMsg += tName;
       }
-      errMsg += " but defined column has type ";
+      errMsg += " but ";
+      errMsg += colKind;
+      errMsg += " column has type ";
       if (colTypeName.empty()) {
          auto &id = colTId;
          errMsg += id.name();
@@ -50,3 +52,8 @@ void ROOT::Internal::RDF::CheckDefineType(RDefineBase &define, const std::type_i
       throw std::runtime_error(errMsg);
    }
 }
+
+void ROOT::Internal::RDF::CheckDefineType(RDefineBase &define, const std::type_info &tid)
+{
+   CheckReaderType("RDefineReader", define.GetName(), "defined", define.GetTypeId(), tid);
+}
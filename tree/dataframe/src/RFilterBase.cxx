@@ -15,9 +15,9 @@
 using namespace ROOT::Detail::RDF;
 
 RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const unsigned int nSlots,
-                         const RDFInternal::RBookedDefines &defines)
-   : RNodeBase(implPtr), fLastResult(nSlots), fAccepted(nSlots), fRejected(nSlots), fName(name), fNSlots(nSlots),
-     fDefines(defines) {}
+                         const RDFInternal::RBookedDefines &defines, std::string_view variationName)
+   : RNodeBase(implPtr), fLastResult(nSlots), fAccepted(nSlots), fRejected(nSlots), fBulkMasks(nSlots), fName(name),
+     fNSlots(nSlots), fDefines(defines), fVariation(variationName) {}
 
 // outlined to pin virtual table
 RFilterBase::~RFilterBase() {}
@@ -44,6 +44,8 @@ void RFilterBase::FillReport(ROOT::RDF::RCutFlowReport &rep) const
 void RFilterBase::InitNode()
 {
    fLastCheckedEntry = std::vector<Long64_t>(fNSlots, -1);
+   for (auto &mask : fBulkMasks)
+      mask.Invalidate();
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
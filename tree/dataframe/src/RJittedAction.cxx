@@ -26,6 +26,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, firstEntry, bulkSize);
+}
+
 void RJittedAction::Initialize()
 {
    R__ASSERT(fConcreteAction != nullptr);
@@ -93,3 +99,22 @@ std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> RJittedAction::GetMergea
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetMergeableValue();
 }
+
+std::vector<std::string> RJittedAction::GetVariations() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariations();
+}
+
+std::unique_ptr<ROOT::Internal::RDF::RActionBase>
+RJittedAction::MakeVariedAction(const std::string &variationName, void *newResult)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(variationName, newResult);
+}
+
+std::string RJittedAction::GetFingerprint() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetFingerprint();
+}
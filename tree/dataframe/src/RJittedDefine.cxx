@@ -37,8 +37,32 @@ void RJittedDefine::Update(unsigned int slot, Long64_t entry)
    fConcreteDefine->Update(slot, entry);
 }
 
+void *RJittedDefine::UpdateBulk(unsigned int slot, const RDFInternal::RMaskedEntryRange &mask)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->UpdateBulk(slot, mask);
+}
+
 void RJittedDefine::FinaliseSlot(unsigned int slot)
 {
    R__ASSERT(fConcreteDefine != nullptr);
    fConcreteDefine->FinaliseSlot(slot);
 }
+
+std::vector<std::string> RJittedDefine::GetVariations() const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariations();
+}
+
+RDefineBase &RJittedDefine::GetVariedDefine(const std::string &variationName)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariedDefine(variationName);
+}
+
+std::string RJittedDefine::GetFingerprint(const std::string &codeVersion) const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetFingerprint(codeVersion);
+}
@@ -20,6 +20,7 @@ RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name)
 
 void RJittedFilter::SetFilter(std::unique_ptr<RFilterBase> f)
 {
+   f->SetExpressionId(fExpressionId);
    fConcreteFilter = std::move(f);
 }
 
@@ -35,6 +36,13 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const RDFInternal::RMaskedEntryRange &
+RJittedFilter::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, firstEntry, bulkSize);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -89,6 +97,34 @@ void RJittedFilter::FinaliseSlot(unsigned int slot)
    fConcreteFilter->FinaliseSlot(slot);
 }
 
+std::vector<std::string> RJittedFilter::GetVariations() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariations();
+}
+
+/// The varied clone of a jitted filter wraps the varied clone of its concrete filter.
+/// Only the latter is booked with the RLoopManager.
+std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &variationName)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   auto it = fVariedFilters.find(variationName);
+   if (it != fVariedFilters.end())
+      return it->second;
+
+   auto variedFilter = std::make_shared<RJittedFilter>(fLoopManager, "");
+   variedFilter->fConcreteFilter =
+      std::static_pointer_cast<RFilterBase>(fConcreteFilter->GetVariedFilter(variationName));
+   fVariedFilters[variationName] = variedFilter;
+   return variedFilter;
+}
+
+std::string RJittedFilter::GetFingerprint() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetFingerprint();
+}
+
 void RJittedFilter::InitNode()
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -5,6 +5,7 @@
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
+#include "ROOT/RDF/RResultCache.hxx"
 #include "ROOT/RDF/RSlotStack.hxx"
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h" // Long64_t
@@ -12,11 +13,13 @@
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TChain.h"
+#include "TDirectory.h"
 #include "TEntryList.h"
 #include "TFile.h"
 #include "TFriendElement.h"
 #include "TInterpreter.h"
 #include "TROOT.h" // IsImplicitMTEnabled
+#include "TSystem.h"
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
 
@@ -204,6 +207,48 @@ static void GetBranchNamesImpl(TTree &t, std::set<std::string> &bNamesReg, Colum
    }
 }
 
+/// Return a description of the files the tree reads its entries from, including their size and modification time, or
+/// an empty string if the entries read cannot be identified (e.g. for in-memory trees).
+static std::string GetTreeFingerprint(TTree &tree)
+{
+   // the selection performed by entry lists is not tracked
+   if (tree.GetEntryList() != nullptr)
+      return "";
+
+   std::string fingerprint = std::string("Tree ") + tree.GetName();
+   auto addFile = [&fingerprint](const char *fileName) {
+      fingerprint += std::string(" ") + fileName;
+      // only the name of remote files is tracked, their size and modification time are not available
+      FileStat_t stat;
+      if (gSystem->GetPathInfo(fileName, stat) == 0)
+         fingerprint += " " + std::to_string(stat.fSize) + " " + std::to_string(stat.fMtime);
+   };
+
+   if (auto chain = dynamic_cast<TChain *>(&tree)) {
+      // the title of a chain element is the name of the file, its name the name of the tree
+      for (auto elementObj : *chain->GetListOfFiles()) {
+         addFile(elementObj->GetTitle());
+         fingerprint += std::string(" ") + elementObj->GetName();
+      }
+   } else if (auto file = tree.GetCurrentFile()) {
+      addFile(file->GetName());
+   } else {
+      return "";
+   }
+
+   if (auto friendTrees = tree.GetListOfFriends()) {
+      for (auto friendTreeObj : *friendTrees) {
+         auto friendTree = ((TFriendElement *)friendTreeObj)->GetTree();
+         const auto friendFingerprint = friendTree ? GetTreeFingerprint(*friendTree) : "";
+         if (friendFingerprint.empty())
+            return "";
+         fingerprint += std::string(" Friend ") + friendTreeObj->GetName() + " " + friendFingerprint;
+      }
+   }
+
+   return fingerprint;
+}
+
 static void ThrowIfNSlotsChanged(unsigned int nSlots)
 {
    const auto currentSlots = RDFInternal::GetNSlots();
@@ -288,6 +333,29 @@ DatasetLogInfo TreeDatasetLogInfo(const TTreeReader &r, unsigned int slot)
    return {std::move(what), static_cast<ULong64_t>(entryRange.first), end, slot};
 }
 
+#ifdef R__USE_IMT
+/// Log the processing time of each task at debug level, and a summary that points to the slowest task.
+void LogTaskTimings(const std::vector<ROOT::TTreeProcessorMT::TTaskTiming> &timings)
+{
+   if (timings.empty())
+      return;
+
+   double totalTime = 0.;
+   const ROOT::TTreeProcessorMT::TTaskTiming *slowest = &timings.front();
+   for (const auto &t : timings) {
+      R__LOG_DEBUG(0, RDFLogChannel()) << "Processed entry range [" << t.fStart << "," << t.fEnd - 1 << "] of file \""
+                                       << t.fFileName << "\" in " << t.fRealTime << "s.";
+      totalTime += t.fRealTime;
+      if (t.fRealTime > slowest->fRealTime)
+         slowest = &t;
+   }
+   R__LOG_INFO(RDFLogChannel()) << "Processed " << timings.size() << " tasks in " << totalTime << "s (mean "
+                                << totalTime / timings.size() << "s per task). The slowest task processed entry range ["
+                                << slowest->fStart << "," << slowest->fEnd - 1 << "] of file \"" << slowest->fFileName
+                                << "\" in " << slowest->fRealTime << "s.";
+}
+#endif
+
 } // anonymous namespace
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -304,19 +372,19 @@ ColumnNames_t ROOT::Internal::RDF::GetBranchNames(TTree &t, bool allowDuplicates
 
 RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
-     fNSlots(RDFInternal::GetNSlots()),
+     fNSlots(RDFInternal::GetNSlots()), fBulkMasks(fNSlots),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles)
 {
 }
 
 RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
-   : fNEmptyEntries(nEmptyEntries), fNSlots(RDFInternal::GetNSlots()),
+   : fNEmptyEntries(nEmptyEntries), fNSlots(RDFInternal::GetNSlots()), fBulkMasks(fNSlots),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
-   : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
+   : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()), fBulkMasks(fNSlots),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
      fDataSource(std::move(ds))
 {
@@ -351,15 +419,23 @@ void RLoopManager::RunEmptySourceMT()
       start = end;
    }
 
+   const auto bulkSize = GetEffectiveBulkSize();
+
    // Each task will generate a subrange of entries
-   auto genFunction = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+   auto genFunction = [this, &slotStack, bulkSize](const std::pair<ULong64_t, ULong64_t> &range) {
       RSlotRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       InitNodeSlots(nullptr, slot);
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (bulkSize > 1) {
+            for (auto firstEntry = range.first; firstEntry < range.second; firstEntry += bulkSize) {
+               RunAndCheckFiltersBulk(slot, firstEntry, std::min<ULong64_t>(bulkSize, range.second - firstEntry));
+            }
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          CleanUpTask(slot);
@@ -379,11 +455,19 @@ void RLoopManager::RunEmptySourceMT()
 /// Run event loop with no source files, in sequence.
 void RLoopManager::RunEmptySource()
 {
+   const auto bulkSize = GetEffectiveBulkSize();
    InitNodeSlots(nullptr, 0);
    R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({"an empty source", 0, fNEmptyEntries, 0u});
    try {
-      for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (bulkSize > 1) {
+         for (ULong64_t firstEntry = 0; firstEntry < fNEmptyEntries && fNStopsReceived < fNChildren;
+              firstEntry += bulkSize) {
+            RunAndCheckFiltersBulk(0, firstEntry, std::min<ULong64_t>(bulkSize, fNEmptyEntries - firstEntry));
+         }
+      } else {
+         for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       CleanUpTask(0u);
@@ -400,6 +484,7 @@ void RLoopManager::RunTreeProcessorMT()
    RSlotStack slotStack(fNSlots);
    const auto &entryList = fTree->GetEntryList() ? *fTree->GetEntryList() : TEntryList();
    auto tp = std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
+   tp->SetDynamicLoadBalancing(true);
 
    std::atomic<ULong64_t> entryCount(0ull);
 
@@ -423,6 +508,8 @@ void RLoopManager::RunTreeProcessorMT()
       }
       CleanUpTask(slot);
    });
+
+   LogTaskTimings(tp->GetTaskTimings());
 #endif // no-op otherwise (will not be called)
 }
 
@@ -458,6 +545,7 @@ void RLoopManager::RunTreeReader()
 void RLoopManager::RunDataSource()
 {
    R__ASSERT(fDataSource != nullptr);
+   const auto bulkSize = GetEffectiveBulkSize();
    fDataSource->Initialise();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty() && fNStopsReceived < fNChildren) {
@@ -468,9 +556,17 @@ void RLoopManager::RunDataSource()
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
-            for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+            if (bulkSize > 1) {
+               for (auto firstEntry = start; firstEntry < end && fNStopsReceived < fNChildren;
+                    firstEntry += bulkSize) {
+                  fDataSource->SetEntry(0u, firstEntry);
+                  RunAndCheckFiltersBulk(0u, firstEntry, std::min<ULong64_t>(bulkSize, end - firstEntry));
+               }
+            } else {
+               for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
+                  if (fDataSource->SetEntry(0u, entry)) {
+                     RunAndCheckFilters(0u, entry);
+                  }
                }
             }
          }
@@ -493,9 +589,10 @@ void RLoopManager::RunDataSourceMT()
    R__ASSERT(fDataSource != nullptr);
    RSlotStack slotStack(fNSlots);
    ROOT::TThreadExecutor pool;
+   const auto bulkSize = GetEffectiveBulkSize();
 
    // Each task works on a subrange of entries
-   auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+   auto runOnRange = [this, &slotStack, bulkSize](const std::pair<ULong64_t, ULong64_t> &range) {
       RSlotRAII slotRAII(slotStack);
       const auto slot = slotRAII.fSlot;
       InitNodeSlots(nullptr, slot);
@@ -504,9 +601,16 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+         if (bulkSize > 1) {
+            for (auto firstEntry = start; firstEntry < end; firstEntry += bulkSize) {
+               fDataSource->SetEntry(slot, firstEntry);
+               RunAndCheckFiltersBulk(slot, firstEntry, std::min<ULong64_t>(bulkSize, end - firstEntry));
+            }
+         } else {
+            for (auto entry = start; entry < end; ++entry) {
+               if (fDataSource->SetEntry(slot, entry)) {
+                  RunAndCheckFilters(slot, entry);
+               }
             }
          }
       } catch (...) {
@@ -540,6 +644,42 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Bulk version of RunAndCheckFilters: process the entries [firstEntry, firstEntry + bulkSize) at once.
+/// Filters evaluate their masks once per bulk and cache them, so named filters do not run twice.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, firstEntry, bulkSize);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, firstEntry, bulkSize);
+   for (auto &callback : fCallbacks)
+      callback(slot, bulkSize);
+}
+
+/// Return the number of entries to process at once in this event loop.
+/// Bulk processing requires that all column readers can provide values for a range of entries: if that is not the
+/// case, entries are processed one by one.
+std::size_t RLoopManager::GetEffectiveBulkSize() const
+{
+   if (fBulkSize == 1)
+      return 1;
+
+   std::string reason;
+   if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT)
+      reason = "TTree branches are read entry by entry";
+   else if (fDataSource && !fDataSource->SupportsBulkReading())
+      reason = "data source " + fDataSource->GetLabel() + " does not support bulk reading";
+   else if (!fDSValuePtrMap.empty())
+      reason = "some data source columns are read through the per-entry value pointers interface";
+
+   if (!reason.empty()) {
+      R__LOG_INFO(RDFLogChannel()) << "A bulk size of " << fBulkSize << " was requested but " << reason
+                                   << ": processing entries one by one.";
+      return 1;
+   }
+   return fBulkSize;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
@@ -551,6 +691,7 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
       ptr->InitSlot(r, slot);
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+   fBulkMasks[slot].Invalidate();
 }
 
 /// Initialize all nodes of the functional graph before running the event loop.
@@ -649,6 +790,19 @@ void RLoopManager::Run()
 
    Jit();
 
+   // results to be stored in the result cache at the end of the event loop, with their keys
+   std::vector<std::pair<RDFInternal::RActionBase *, std::string>> resultsToCache;
+   if (IsResultCacheEnabled()) {
+      const auto nBookedActions = fBookedActions.size();
+      resultsToCache = RestoreCachedResults();
+      if (nBookedActions > 0 && fBookedActions.empty()) {
+         R__LOG_INFO(RDFLogChannel()) << "All results were retrieved from the result cache: skipping event loop number "
+                                      << fNRuns << '.';
+         CleanUpNodes();
+         return;
+      }
+   }
+
    InitNodes();
 
    TStopwatch s;
@@ -665,12 +819,93 @@ void RLoopManager::Run()
 
    CleanUpNodes();
 
+   StoreCachedResults(resultsToCache);
+
    fNRuns++;
 
    R__LOG_INFO(RDFLogChannel()) << "Finished event loop number " << fNRuns - 1 << " (" << s.CpuTime() << "s CPU, "
                                 << s.RealTime() << "s elapsed).";
 }
 
+/// Return a digest of the input dataset, or an empty string if it cannot be identified across processes.
+/// For TTrees, it includes the names, sizes and modification times of the files. Data sources are not supported.
+std::string RLoopManager::MakeSourceFingerprint() const
+{
+   switch (fLoopType) {
+   case ELoopType::kNoFiles:
+   case ELoopType::kNoFilesMT: return RDFInternal::MakeFingerprint("EmptySource " + std::to_string(fNEmptyEntries));
+   case ELoopType::kROOTFiles:
+   case ELoopType::kROOTFilesMT: {
+      const auto treeFingerprint = GetTreeFingerprint(*fTree);
+      return treeFingerprint.empty() ? "" : RDFInternal::MakeFingerprint(treeFingerprint);
+   }
+   case ELoopType::kDataSource:
+   case ELoopType::kDataSourceMT: return "";
+   }
+   return "";
+}
+
+/// Retrieve the results of the booked actions from the result cache. Actions whose results are retrieved are marked
+/// as run. Return the actions whose results must be stored in the cache after the event loop, with their keys.
+std::vector<std::pair<RActionBase *, std::string>> RLoopManager::RestoreCachedResults()
+{
+   std::vector<std::pair<RActionBase *, std::string>> resultsToCache;
+
+   fSourceFingerprint = MakeSourceFingerprint();
+   if (fSourceFingerprint.empty()) {
+      R__LOG_INFO(RDFLogChannel()) << "The input dataset cannot be identified, the result cache will not be used. Only "
+                                      "TTrees read from files and empty sources are supported.";
+      return resultsToCache;
+   }
+
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> cacheFile;
+   if (!gSystem->AccessPathName(fResultCacheFile.c_str())) // AccessPathName returns false if the file exists
+      cacheFile.reset(TFile::Open(fResultCacheFile.c_str(), "READ"));
+
+   std::vector<RActionBase *> restoredActions;
+   for (auto *action : fBookedActions) {
+      auto *cachedResult = action->GetCachedResult();
+      if (cachedResult == nullptr)
+         continue;
+      const auto actionFingerprint = action->GetFingerprint();
+      if (actionFingerprint.empty())
+         continue;
+      const auto key = RDFInternal::MakeFingerprint(actionFingerprint + " " + cachedResult->GetInitialState());
+      if (cacheFile && !cacheFile->IsZombie() && cachedResult->Read(*cacheFile, key))
+         restoredActions.emplace_back(action);
+      else
+         resultsToCache.emplace_back(action, key);
+   }
+
+   for (auto *action : restoredActions) {
+      action->SetHasRun();
+      RDFInternal::Erase(action, fBookedActions);
+      fRunActions.emplace_back(action);
+   }
+   R__LOG_INFO(RDFLogChannel()) << restoredActions.size() << " result(s) retrieved from the result cache "
+                                << fResultCacheFile << ", " << resultsToCache.size() << " to be computed and stored.";
+
+   return resultsToCache;
+}
+
+/// Write the given results to the result cache, with their keys.
+void RLoopManager::StoreCachedResults(const std::vector<std::pair<RActionBase *, std::string>> &results)
+{
+   if (results.empty())
+      return;
+
+   TDirectory::TContext ctxt;
+   std::unique_ptr<TFile> cacheFile(TFile::Open(fResultCacheFile.c_str(), "UPDATE"));
+   if (!cacheFile || cacheFile->IsZombie()) {
+      R__LOG_WARNING(RDFLogChannel()) << "Could not open the result cache " << fResultCacheFile
+                                      << " for writing: results will be computed again in the next event loop.";
+      return;
+   }
+   for (const auto &result : results)
+      result.first->GetCachedResult()->Write(*cacheFile, result.second);
+}
+
 /// Return the list of default columns -- empty if none was provided when constructing the RDataFrame
 const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
 {
@@ -724,6 +959,37 @@ bool RLoopManager::CheckFilters(unsigned int, Long64_t)
    return true;
 }
 
+/// The head node does not depend on any systematic variation, so it is never asked for a varied clone
+std::shared_ptr<RNodeBase> RLoopManager::GetVariedFilter(const std::string &variationName)
+{
+   throw std::logic_error("RLoopManager cannot be varied, but it was asked for universe \"" + variationName + "\".");
+}
+
+/// The head node selects all entries of the bulk
+const RMaskedEntryRange &RLoopManager::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   auto &mask = fBulkMasks[slot];
+   if (!mask.IsRange(firstEntry, bulkSize))
+      mask.Reset(firstEntry, bulkSize, true);
+   return mask;
+}
+
+/// Set the number of entries that the event loop processes at once, see RInterface::SetBulkSize.
+void RLoopManager::SetBulkSize(std::size_t bulkSize)
+{
+   if (bulkSize == 0)
+      throw std::runtime_error("The bulk size must be at least 1.");
+   fBulkSize = bulkSize;
+}
+
+/// Set the file that stores the results of the event loops and the version of the compiled code of the analysis,
+/// see RInterface::SetResultCache.
+void RLoopManager::SetResultCache(std::string_view fileName, std::string_view codeVersion)
+{
+   fResultCacheFile = std::string(fileName);
+   fResultCacheCodeVersion = std::string(codeVersion);
+}
+
 /// Call `FillReport` on all booked filters
 void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 {
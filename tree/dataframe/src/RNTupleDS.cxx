@@ -15,6 +15,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RDF/RMaskedEntryRange.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RFieldValue.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -24,7 +25,17 @@
 #include <ROOT/RStringView.hxx>
 
 #include <TError.h>
-
+#include <TRegexp.h>
+#include <TString.h>
+#include <TSystem.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -38,14 +49,27 @@ class RNTupleColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
    using RFieldValue = ROOT::Experimental::Detail::RFieldValue;
    using RPageSource = ROOT::Experimental::Detail::RPageSource;
 
+   std::string fColumnName;
+   /// The page source and the first global entry of the file that the slot currently processes
+   const RNTupleDS::RSlotInfo &fSlot;
+   /// The slot generation that the field is connected to; zero if the field is not yet connected
+   std::uint64_t fGeneration = 0;
+   /// Keeps the page source alive as long as the field is connected to it, even if the slot moved on
+   std::shared_ptr<RPageSource> fSource;
    std::unique_ptr<RFieldBase> fField;
    RFieldValue fValue;
-   Long64_t fLastEntry; ///< Last entry number that was read
+   Long64_t fLastEntry = -1; ///< Last entry number that was read
+   /// In bulk mode, the values of the current bulk are constructed in fBulkBuffer, one after the other
+   std::unique_ptr<unsigned char[]> fBulkBuffer;
+   std::vector<RFieldValue> fBulkValues;
+   ROOT::Internal::RDF::RMaskedEntryRange fBulkLoaded; ///< The entries of the current bulk that have been read
 
    std::unique_ptr<RFieldBase> MakeField(const std::string &colName, RPageSource &source)
    {
       const auto &descriptor = source.GetDescriptor();
       const auto fieldId = descriptor.FindFieldId(colName);
+      if (fieldId == kInvalidDescriptorId)
+         throw std::runtime_error("RNTupleDS: no field named " + colName + " in ntuple " + descriptor.GetName());
       const auto &fieldDescriptor = descriptor.GetFieldDescriptor(fieldId);
       const auto typeName = fieldDescriptor.GetTypeName();
       auto fieldBasePtr = Detail::RFieldBase::Create(fieldDescriptor.GetFieldName(), typeName).Unwrap();
@@ -53,32 +77,158 @@ class RNTupleColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
       return fieldBasePtr;
    }
 
+   void ReleaseBulk()
+   {
+      for (auto &value : fBulkValues)
+         fField->DestroyValue(value, true /* dtorOnly */);
+      fBulkValues.clear();
+      fBulkLoaded.Invalidate();
+   }
+
+   void AllocateBulk(std::size_t bulkSize)
+   {
+      ReleaseBulk();
+      const auto valueSize = fField->GetValueSize();
+      R__ASSERT(fField->GetAlignment() <= alignof(std::max_align_t));
+      fBulkBuffer.reset(new unsigned char[bulkSize * valueSize]);
+      fBulkValues.reserve(bulkSize);
+      for (std::size_t i = 0; i < bulkSize; ++i)
+         fBulkValues.emplace_back(fField->GenerateValue(fBulkBuffer.get() + i * valueSize));
+   }
+
+   void ReleaseField()
+   {
+      if (!fField)
+         return;
+      ReleaseBulk();
+      fField->DestroyValue(fValue);
+      fField.reset();
+   }
+
+   /// (Re-)creates the field for the page source of the slot
+   void Connect()
+   {
+      ReleaseField();
+      fSource = fSlot.fSource;
+      fField = MakeField(fColumnName, *fSource);
+      fValue = fField->GenerateValue();
+      fGeneration = fSlot.fGeneration;
+      fLastEntry = -1;
+   }
+
 public:
-   RNTupleColumnReader(const std::string &colName, RPageSource &source)
-      : fField(MakeField(colName, source)), fValue(fField->GenerateValue()), fLastEntry(-1)
+   RNTupleColumnReader(const std::string &colName, const RNTupleDS::RSlotInfo &slot)
+      : fColumnName(colName), fSlot(slot)
    {
    }
+   RNTupleColumnReader(const RNTupleColumnReader &other) = delete;
+   RNTupleColumnReader &operator =(const RNTupleColumnReader &other) = delete;
+   ~RNTupleColumnReader() { ReleaseField(); }
 
    void *GetImpl(Long64_t entry) final
    {
+      if (fGeneration != fSlot.fGeneration)
+         Connect();
       if (entry != fLastEntry) {
-         fField->Read(entry, &fValue);
+         fField->Read(entry - fSlot.fFirstEntry, &fValue);
          fLastEntry = entry;
       }
       return fValue.GetRawPtr();
    }
+
+   void *GetBulkImpl(const ROOT::Internal::RDF::RMaskedEntryRange &mask) final
+   {
+      if (fGeneration != fSlot.fGeneration)
+         Connect();
+      const auto bulkSize = mask.Size();
+      if (!fBulkLoaded.IsRange(mask.FirstEntry(), bulkSize)) {
+         if (fBulkValues.size() < bulkSize)
+            AllocateBulk(bulkSize);
+         fBulkLoaded.Reset(mask.FirstEntry(), bulkSize, false);
+      }
+      // The entries of a bulk are always in the file that the slot currently processes
+      const auto firstIndex = mask.FirstEntry() - fSlot.fFirstEntry;
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (!mask[i] || fBulkLoaded[i])
+            continue;
+         fField->Read(firstIndex + i, &fBulkValues[i]);
+         fBulkLoaded[i] = true;
+      }
+      return fBulkBuffer.get();
+   }
 };
 } // namespace Detail
 
-void RNTupleDS::AddFields(const RNTupleDescriptor &desc, DescriptorId_t parentId)
+namespace {
+/// Intersects two ascending lists of disjoint ranges [first, last)
+std::vector<std::pair<NTupleSize_t, NTupleSize_t>>
+IntersectRanges(const std::vector<std::pair<NTupleSize_t, NTupleSize_t>> &a,
+                const std::vector<std::pair<NTupleSize_t, NTupleSize_t>> &b)
+{
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> result;
+   std::size_t i = 0;
+   std::size_t j = 0;
+   while (i < a.size() && j < b.size()) {
+      const auto first = std::max(a[i].first, b[j].first);
+      const auto last = std::min(a[i].second, b[j].second);
+      if (first < last)
+         result.emplace_back(first, last);
+      if (a[i].second < b[j].second)
+         ++i;
+      else
+         ++j;
+   }
+   return result;
+}
+
+/// Expands wildcards in the last path component in the same way as TChain::Add(); the matches are sorted
+std::vector<std::string> ExpandFileName(const std::string &fileName)
 {
-   for (const auto& f : desc.GetFieldRange(parentId)) {
-      fColumnNames.emplace_back(desc.GetQualifiedFieldName(f.GetId()));
-      fColumnTypes.emplace_back(f.GetTypeName());
+   TString basename(fileName);
+   if (!basename.MaybeWildcard())
+      return {fileName};
+
+   TString directory;
+   auto slashpos = basename.Last('/');
+   if (slashpos >= 0) {
+      directory = basename(0, slashpos);
+      basename.Remove(0, slashpos + 1);
+   } else {
+      directory = gSystem->UnixPathName(gSystem->WorkingDirectory());
+   }
+
+   std::vector<std::string> result;
+   const char *epath = gSystem->ExpandPathName(directory.Data());
+   void *dir = gSystem->OpenDirectory(epath);
+   delete[] epath;
+   if (!dir)
+      return result;
+   TRegexp re(basename, kTRUE);
+   while (const char *file = gSystem->GetDirEntry(dir)) {
+      if (!strcmp(file, ".") || !strcmp(file, ".."))
+         continue;
+      TString s = file;
+      if ((basename != file) && s.Index(re) == kNPOS)
+         continue;
+      result.emplace_back(std::string(directory.Data()) + "/" + file);
+   }
+   gSystem->FreeDirectory(dir);
+   std::sort(result.begin(), result.end());
+   return result;
+}
+
+/// Appends the qualified names and the type names of the fields below parentId, depth first
+void AddFields(const RNTupleDescriptor &desc, DescriptorId_t parentId, std::vector<std::string> &names,
+               std::vector<std::string> &types)
+{
+   for (const auto &f : desc.GetFieldRange(parentId)) {
+      names.emplace_back(desc.GetQualifiedFieldName(f.GetId()));
+      types.emplace_back(f.GetTypeName());
       if (f.GetStructure() == ENTupleStructure::kRecord)
-         AddFields(desc, f.GetId());
+         AddFields(desc, f.GetId(), names, types);
    }
 }
+} // anonymous namespace
 
 
 RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
@@ -86,9 +236,80 @@ RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
    pageSource->Attach();
    const auto &descriptor = pageSource->GetDescriptor();
 
-   AddFields(descriptor, descriptor.GetFieldZeroId());
+   AddFields(descriptor, descriptor.GetFieldZeroId(), fColumnNames, fColumnTypes);
+
+   fFiles.emplace_back();
+   fFiles[0].fSource = std::move(pageSource);
+}
+
+RNTupleDS::RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+   : fNTupleName(ntupleName)
+{
+   for (const auto &f : fileNames) {
+      if (f.empty())
+         throw std::runtime_error("RNTupleDS: empty file name");
+      fFiles.emplace_back();
+      fFiles.back().fFileName = f;
+   }
+   if (fFiles.empty())
+      throw std::runtime_error("RNTupleDS: no files given for ntuple " + fNTupleName);
 
-   fSources.emplace_back(std::move(pageSource));
+   const auto &descriptor = AttachFile(0).GetDescriptor();
+   AddFields(descriptor, descriptor.GetFieldZeroId(), fColumnNames, fColumnTypes);
+}
+
+void RNTupleDS::CheckSchema(std::size_t fileIndex, const RNTupleDescriptor &descriptor) const
+{
+   std::vector<std::string> names;
+   std::vector<std::string> types;
+   AddFields(descriptor, descriptor.GetFieldZeroId(), names, types);
+   const auto &fileName = fFiles[fileIndex].fFileName;
+   for (std::size_t i = 0; i < std::max(names.size(), fColumnNames.size()); ++i) {
+      if (i >= names.size()) {
+         throw std::runtime_error("RNTupleDS: field " + fColumnNames[i] + " is missing in ntuple " + fNTupleName +
+                                  " in file " + fileName);
+      }
+      if (i >= fColumnNames.size() || names[i] != fColumnNames[i]) {
+         throw std::runtime_error("RNTupleDS: unexpected field " + names[i] + " in ntuple " + fNTupleName +
+                                  " in file " + fileName + "; all files need the fields of the first file");
+      }
+      if (types[i] != fColumnTypes[i]) {
+         throw std::runtime_error("RNTupleDS: field " + names[i] + " in ntuple " + fNTupleName + " in file " +
+                                  fileName + " has type " + types[i] + " instead of " + fColumnTypes[i]);
+      }
+   }
+}
+
+Detail::RPageSource &RNTupleDS::AttachFile(std::size_t fileIndex)
+{
+   auto &file = fFiles[fileIndex];
+   if (!file.fSource) {
+      file.fSource = Detail::RPageSource::Create(fNTupleName, file.fFileName);
+      file.fSource->Attach();
+      // The schema of the first file is the schema of the data source
+      if (fileIndex > 0)
+         CheckSchema(fileIndex, file.fSource->GetDescriptor());
+   }
+   file.fFirstEntry = (fileIndex == 0) ? 0 : fFiles[fileIndex - 1].fFirstEntry + fFiles[fileIndex - 1].fNEntries;
+   file.fNEntries = file.fSource->GetNEntries();
+   return *file.fSource;
+}
+
+std::unique_ptr<Detail::RPageSource> RNTupleDS::OpenFileForSlot(std::size_t fileIndex)
+{
+   std::unique_ptr<Detail::RPageSource> source;
+   {
+      std::lock_guard<std::mutex> lockGuard(fLockFiles);
+      auto &file = fFiles[fileIndex];
+      if (file.fFileName.empty())
+         source = file.fSource->Clone();
+      else if (file.fSource)
+         return std::move(file.fSource);
+   }
+   if (!source)
+      source = Detail::RPageSource::Create(fNTupleName, fFiles[fileIndex].fFileName);
+   source->Attach();
+   return source;
 }
 
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
@@ -100,33 +321,79 @@ RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* n
 std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
 RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info & /*tid*/)
 {
-   return std::make_unique<ROOT::Experimental::Detail::RNTupleColumnReader>(std::string(name), *fSources[slot]);
+   return std::make_unique<ROOT::Experimental::Detail::RNTupleColumnReader>(std::string(name), fSlots[slot]);
 }
 
-bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
+bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
+   auto &slotInfo = fSlots[slot];
+   if ((entry >= slotInfo.fFirstEntry) && (entry < slotInfo.fLastEntry))
+      return true;
+
+   // The entry ranges never span files, so that the slot switches files at most once per range
+   auto itr = std::upper_bound(fFiles.begin(), fFiles.begin() + fNextFile, entry,
+                               [](ULong64_t e, const RFileInfo &file) { return e < file.fFirstEntry; });
+   R__ASSERT(itr != fFiles.begin());
+   const auto fileIndex = std::distance(fFiles.begin(), itr) - 1;
+   // A slot that returns to a file reuses the page source it opened before in this event loop
+   if (slotInfo.fFileSources.empty())
+      slotInfo.fFileSources.resize(fFiles.size());
+   auto &source = slotInfo.fFileSources[fileIndex];
+   if (!source)
+      source = OpenFileForSlot(fileIndex);
+   slotInfo.fSource = source;
+   slotInfo.fFirstEntry = fFiles[fileIndex].fFirstEntry;
+   slotInfo.fLastEntry = fFiles[fileIndex].fFirstEntry + fFiles[fileIndex].fNEntries;
+   slotInfo.fGeneration++;
    return true;
 }
 
+void RNTupleDS::AddRangeFilter(std::string_view fieldName, double min, double max)
+{
+   if ((fieldName.find('.') != std::string_view::npos) || !HasColumn(fieldName))
+      throw std::runtime_error("RNTupleDS: no top-level field named " + std::string(fieldName));
+   fRangeFilters.push_back({std::string(fieldName), min, max});
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetFileEntryRanges(std::size_t fileIndex)
+{
+   const auto &descriptor = AttachFile(fileIndex).GetDescriptor();
+   auto candidates = descriptor.GetClusterEntryRanges();
+   // The first column of a top-level field has one element per entry, so that element ranges are entry ranges
+   for (const auto &filter : fRangeFilters) {
+      const auto fieldId = descriptor.FindFieldId(filter.fFieldName);
+      if (fieldId == kInvalidDescriptorId)
+         throw std::runtime_error("RNTupleDS: no top-level field named " + filter.fFieldName);
+      const auto columnId = descriptor.FindColumnId(fieldId, 0);
+      if (columnId == kInvalidDescriptorId)
+         throw std::runtime_error("RNTupleDS: field " + filter.fFieldName + " has no column");
+      candidates =
+         IntersectRanges(candidates, descriptor.FindElementRangesInRange(columnId, filter.fMin, filter.fMax));
+   }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   const auto firstEntry = fFiles[fileIndex].fFirstEntry;
+   for (const auto &c : candidates)
+      ranges.emplace_back(firstEntry + c.first, firstEntry + c.second);
+   return ranges;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
+   // Every range is (part of) a cluster.  Files are processed in order and only opened once their ranges are needed.
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges) return ranges;
 
-   auto nEntries = fSources[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
-   }
-   ranges.back().second += reminder;
-   fHasSeenAllRanges = true;
+   while ((fNextFile < fFiles.size()) && (ranges.size() < kMinRangesPerSlot * fNSlots)) {
+      auto fileRanges = GetFileEntryRanges(fNextFile);
+      // Unless given by the user, the page source of a file without any (selected) entries is not needed anymore
+      if (fileRanges.empty() && !fFiles[fNextFile].fFileName.empty())
+         fFiles[fNextFile].fSource.reset();
+      ranges.insert(ranges.end(), fileRanges.begin(), fileRanges.end());
+      ++fNextFile;
+   }
+   if (fNextFile == fFiles.size())
+      fHasSeenAllRanges = true;
    return ranges;
 }
 
@@ -148,12 +415,21 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
 
 void RNTupleDS::Initialise()
 {
+   fNextFile = 0;
    fHasSeenAllRanges = false;
 }
 
 
 void RNTupleDS::Finalise()
 {
+   // Page sources used to compute the entry ranges that were not handed over to a slot
+   for (auto &file : fFiles) {
+      if (!file.fFileName.empty())
+         file.fSource.reset();
+   }
+   // The page source that a slot currently reads from remains available to the next event loop
+   for (auto &slot : fSlots)
+      slot.fFileSources.clear();
 }
 
 
@@ -162,12 +438,8 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    R__ASSERT(fNSlots == 0);
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
-
-   for (unsigned int i = 1; i < fNSlots; ++i) {
-      fSources.emplace_back(fSources[0]->Clone());
-      R__ASSERT(i == (fSources.size() - 1));
-      fSources[i]->Attach();
-   }
+   // The slot page sources are opened on demand by SetEntry()
+   fSlots.resize(fNSlots);
 }
 } // ns Experimental
 } // ns ROOT
@@ -175,7 +447,17 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
 
 ROOT::RDataFrame ROOT::Experimental::MakeNTupleDataFrame(std::string_view ntupleName, std::string_view fileName)
 {
-   auto pageSource = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
-   ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(std::move(pageSource)));
+   return MakeNTupleDataFrame(ntupleName, std::vector<std::string>{std::string(fileName)});
+}
+
+ROOT::RDataFrame
+ROOT::Experimental::MakeNTupleDataFrame(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+{
+   std::vector<std::string> expandedNames;
+   for (const auto &f : fileNames) {
+      auto matches = ExpandFileName(f);
+      expandedNames.insert(expandedNames.end(), matches.begin(), matches.end());
+   }
+   ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(ntupleName, expandedNames));
    return rdf;
 }
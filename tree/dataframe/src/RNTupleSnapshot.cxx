@@ -0,0 +1,35 @@
+/// \file RNTupleSnapshot.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RNTupleSnapshot.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RSnapshotOptions.hxx>
+
+#include <TString.h>
+
+#include <stdexcept>
+
+ROOT::Experimental::RNTupleWriteOptions
+ROOT::Experimental::Internal::GetNTupleWriteOptions(const ROOT::RDF::RSnapshotOptions &options)
+{
+   TString mode = options.fMode;
+   mode.ToLower();
+   if (mode != "recreate") {
+      throw std::runtime_error("SnapshotNTuple: unsupported file mode \"" + options.fMode +
+                               "\", only \"RECREATE\" is supported.");
+   }
+   RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+   return writeOptions;
+}
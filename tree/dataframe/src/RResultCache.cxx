@@ -0,0 +1,46 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RResultCache.hxx"
+#include "ROOT/RDF/Utils.hxx" // MakeFingerprint
+#include "TBufferFile.h"
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+// outlined to pin virtual table
+RCachedResultBase::~RCachedResultBase() {}
+
+std::string GetObjectFingerprint(const TObject &obj)
+{
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObject(&obj);
+   return MakeFingerprint(std::string(obj.ClassName()) + " " + std::string(buf.Buffer(), buf.Length()));
+}
+
+std::string GetValueFingerprint(Double_t value)
+{
+   std::ostringstream os;
+   os << std::setprecision(std::numeric_limits<Double_t>::max_digits10) << value;
+   return os.str();
+}
+
+std::string GetValueFingerprint(Long64_t value)
+{
+   return std::to_string(value);
+}
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,44 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RVariationBase.hxx"
+
+#include <algorithm> // std::find
+#include <iterator>  // std::distance
+
+using ROOT::Detail::RDF::RVariationBase;
+namespace RDFInternal = ROOT::Internal::RDF;
+
+RVariationBase::RVariationBase(std::string_view columnName, std::string_view variationName,
+                               const std::vector<std::string> &tags, std::string_view type, unsigned int nSlots,
+                               const RDFInternal::RBookedDefines &defines,
+                               const std::map<std::string, std::vector<void *>> &DSValuePtrs,
+                               ROOT::RDF::RDataSource *ds)
+   : fColumnName(columnName), fVariationName(variationName), fTags(tags), fType(type), fNSlots(nSlots),
+     fLastCheckedEntry(fNSlots, -1), fDefines(defines), fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs),
+     fDataSource(ds)
+{
+}
+
+// pin vtable. Work around cling JIT issue.
+RVariationBase::~RVariationBase() {}
+
+std::vector<std::string> RVariationBase::GetVariationNames() const
+{
+   std::vector<std::string> names;
+   names.reserve(fTags.size());
+   for (const auto &tag : fTags)
+      names.emplace_back(fVariationName + ':' + tag);
+   return names;
+}
+
+std::size_t RVariationBase::GetVariationIndex(const std::string &variationName) const
+{
+   const auto names = GetVariationNames();
+   return std::distance(names.begin(), std::find(names.begin(), names.end(), variationName));
+}
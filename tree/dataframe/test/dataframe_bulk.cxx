@@ -0,0 +1,129 @@
+#include "ROOT/RDataFrame.hxx"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using ROOT::RDataFrame;
+
+// Book the same computation graph with different bulk sizes and compare the results with entry-by-entry processing.
+// 1000 entries do not fit a whole number of bulks for any of the tested bulk sizes but 1.
+struct RBulkResults {
+   ULong64_t fCount;
+   double fSum;
+   ULong64_t fMax;
+   ULong64_t fPassEven;
+   ULong64_t fPassSmall;
+   std::vector<ULong64_t> fTaken;
+};
+
+RBulkResults RunGraph(std::size_t bulkSize)
+{
+   RDataFrame df(1000);
+   df.SetBulkSize(bulkSize);
+   auto even = df.Define("x", [](ULong64_t e) { return double(e) / 2.; }, {"rdfentry_"})
+                  .Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"}, "even");
+   auto small = even.Filter([](double x) { return x < 100.; }, {"x"}, "small");
+   auto count = small.Count();
+   auto sum = small.Sum<double>("x");
+   auto max = even.Max<ULong64_t>("rdfentry_");
+   auto taken = small.Filter([](double x) { return x > 90.; }, {"x"}).Take<ULong64_t>("rdfentry_");
+   auto report = df.Report();
+   return {*count,
+           *sum,
+           *max,
+           report->At("even").GetPass(),
+           report->At("small").GetPass(),
+           *taken};
+}
+
+TEST(RDFBulk, SameResultsAsEntryByEntry)
+{
+   const auto expected = RunGraph(1);
+   EXPECT_EQ(expected.fCount, 100u);
+   EXPECT_EQ(expected.fTaken, std::vector<ULong64_t>({182, 184, 186, 188, 190, 192, 194, 196, 198}));
+   for (std::size_t bulkSize : {2u, 7u, 64u, 1024u}) {
+      const auto results = RunGraph(bulkSize);
+      EXPECT_EQ(results.fCount, expected.fCount) << "bulk size " << bulkSize;
+      EXPECT_DOUBLE_EQ(results.fSum, expected.fSum) << "bulk size " << bulkSize;
+      EXPECT_EQ(results.fMax, expected.fMax) << "bulk size " << bulkSize;
+      EXPECT_EQ(results.fPassEven, expected.fPassEven) << "bulk size " << bulkSize;
+      EXPECT_EQ(results.fPassSmall, expected.fPassSmall) << "bulk size " << bulkSize;
+      EXPECT_EQ(results.fTaken, expected.fTaken) << "bulk size " << bulkSize;
+   }
+}
+
+TEST(RDFBulk, DefineEvaluatedOncePerSelectedEntry)
+{
+   RDataFrame df(100);
+   df.SetBulkSize(32);
+   unsigned int nCalls = 0u;
+   auto d = df.Filter([](ULong64_t e) { return e < 50; }, {"rdfentry_"})
+               .Define("x", [&nCalls](ULong64_t e) {
+                  ++nCalls;
+                  return int(e);
+               }, {"rdfentry_"});
+   // "x" is read by a filter and, for a subset of its entries, by two actions
+   auto filtered = d.Filter([](int x) { return x % 5 == 0; }, {"x"});
+   auto s1 = filtered.Sum<int>("x");
+   auto s2 = filtered.Max<int>("x");
+   EXPECT_EQ(*s1, 225);
+   EXPECT_EQ(*s2, 45);
+   EXPECT_EQ(nCalls, 50u);
+}
+
+TEST(RDFBulk, Ranges)
+{
+   RDataFrame df(100);
+   df.SetBulkSize(16);
+   auto c = df.Range(10).Count();
+   auto t = df.Filter([](ULong64_t e) { return e % 2 == 1; }, {"rdfentry_"})
+               .Range(5, 50, 7)
+               .Take<ULong64_t>("rdfentry_");
+   EXPECT_EQ(*c, 10u);
+   EXPECT_EQ(*t, std::vector<ULong64_t>({13, 27, 41, 55, 69, 83, 97}));
+}
+
+TEST(RDFBulk, Callbacks)
+{
+   RDataFrame df(1000);
+   df.SetBulkSize(64);
+   auto c = df.Count();
+   unsigned int nCalls = 0u;
+   c.OnPartialResult(10, [&nCalls](ULong64_t) { ++nCalls; });
+   EXPECT_EQ(*c, 1000u);
+   EXPECT_EQ(nCalls, 100u);
+}
+
+TEST(RDFBulk, InvalidBulkSize)
+{
+   RDataFrame df(1);
+   EXPECT_EQ(df.GetBulkSize(), 1u);
+   EXPECT_THROW(df.SetBulkSize(0), std::runtime_error);
+   df.SetBulkSize(128);
+   EXPECT_EQ(df.GetBulkSize(), 128u);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFBulk, MT)
+{
+   ROOT::EnableImplicitMT(4);
+   RDataFrame df(100000);
+   df.SetBulkSize(256);
+   std::atomic<ULong64_t> nCalls(0ull);
+   auto s = df.Define("x", [&nCalls](ULong64_t e) {
+                 ++nCalls;
+                 return e;
+              }, {"rdfentry_"})
+               .Filter([](ULong64_t x) { return x % 3 == 0; }, {"x"})
+               .Sum<ULong64_t>("x");
+   auto c = df.Count();
+   EXPECT_EQ(*s, 1666683333ull);
+   EXPECT_EQ(*c, 100000ull);
+   EXPECT_EQ(nCalls.load(), 100000ull);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -0,0 +1,170 @@
+#include "ROOT/RDataFrame.hxx"
+#include "TFile.h"
+#include "TH1D.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using ROOT::RDataFrame;
+
+// book Count, Sum and Histo1D on "x > 4.5", with x taking values 0..9, and check the results
+static void CheckResults(RDataFrame &df, ROOT::RDF::RNode d, unsigned int expectedNRuns)
+{
+   auto filtered = d.Filter("x > 4.5");
+   auto count = filtered.Count();
+   auto sum = filtered.Sum<double>("x");
+   auto h = filtered.Histo1D<double>({"h", "h", 10, 0., 10.}, "x");
+   EXPECT_EQ(*count, 5ull);
+   EXPECT_DOUBLE_EQ(*sum, 35.);
+   EXPECT_EQ(h->GetEntries(), 5.);
+   EXPECT_DOUBLE_EQ(h->GetMean(), 7.);
+   EXPECT_EQ(h->GetDirectory(), nullptr);
+   EXPECT_EQ(df.GetNRuns(), expectedNRuns);
+}
+
+static void WriteTree(const char *fileName, int nEntries)
+{
+   TFile f(fileName, "RECREATE");
+   TTree t("t", "t");
+   double x = 0.;
+   t.Branch("x", &x);
+   for (int i = 0; i < nEntries; ++i) {
+      x = i;
+      t.Fill();
+   }
+   t.Write();
+}
+
+TEST(RDFResultCache, EmptySource)
+{
+   const auto cacheFile = "dataframe_resultcache_emptysource.root";
+   gSystem->Unlink(cacheFile);
+   for (auto expectedNRuns : {1u, 0u, 0u}) {
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile);
+      CheckResults(df, df.Define("x", "double(rdfentry_)"), expectedNRuns);
+   }
+   gSystem->Unlink(cacheFile);
+}
+
+TEST(RDFResultCache, CompiledDefine)
+{
+   const auto cacheFile = "dataframe_resultcache_compileddefine.root";
+   gSystem->Unlink(cacheFile);
+   auto makeX = [](ULong64_t e) { return double(e); };
+   // without a code version, results that depend on compiled code are always computed
+   for (auto expectedNRuns : {1u, 1u}) {
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile);
+      CheckResults(df, df.Define("x", makeX, {"rdfentry_"}), expectedNRuns);
+   }
+   for (auto expectedNRuns : {1u, 0u}) {
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile, "v1");
+      CheckResults(df, df.Define("x", makeX, {"rdfentry_"}), expectedNRuns);
+   }
+   // a new code version invalidates the cached results
+   RDataFrame df(10);
+   df.SetResultCache(cacheFile, "v2");
+   CheckResults(df, df.Define("x", makeX, {"rdfentry_"}), 1u);
+   gSystem->Unlink(cacheFile);
+}
+
+TEST(RDFResultCache, CompiledAction)
+{
+   const auto cacheFile = "dataframe_resultcache_compiledaction.root";
+   gSystem->Unlink(cacheFile);
+   auto sum = [](double a, double b) { return a + b; };
+   // Count is retrieved from the cache from the second run on, the compiled reduction only with a code version
+   const std::vector<std::pair<std::string, unsigned int>> runs{{"", 1u}, {"", 1u}, {"v1", 1u}, {"v1", 0u}};
+   for (const auto &run : runs) {
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile, run.first);
+      auto count = df.Count();
+      auto reduced = df.Define("x", "double(rdfentry_)").Reduce(sum, "x");
+      EXPECT_EQ(*count, 10ull);
+      EXPECT_DOUBLE_EQ(*reduced, 45.);
+      EXPECT_EQ(df.GetNRuns(), run.second);
+   }
+   gSystem->Unlink(cacheFile);
+}
+
+TEST(RDFResultCache, ChangedGraph)
+{
+   const auto cacheFile = "dataframe_resultcache_changedgraph.root";
+   gSystem->Unlink(cacheFile);
+   {
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile);
+      CheckResults(df, df.Define("x", "double(rdfentry_)"), 1u);
+   }
+   {
+      // a different expression produces a different result
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile);
+      EXPECT_DOUBLE_EQ(*df.Define("x", "2. * rdfentry_").Filter("x > 4.5").Sum<double>("x"), 84.);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+   }
+   {
+      // a different histogram model must be filled again, the other results are retrieved from the cache
+      RDataFrame df(10);
+      df.SetResultCache(cacheFile);
+      auto filtered = df.Define("x", "double(rdfentry_)").Filter("x > 4.5");
+      auto count = filtered.Count();
+      auto h = filtered.Histo1D<double>({"h", "h", 5, 0., 10.}, "x");
+      EXPECT_EQ(h->GetNbinsX(), 5);
+      EXPECT_EQ(h->GetEntries(), 5.);
+      EXPECT_EQ(*count, 5ull);
+      EXPECT_EQ(df.GetNRuns(), 1u);
+   }
+   gSystem->Unlink(cacheFile);
+}
+
+TEST(RDFResultCache, TreeFromFile)
+{
+   const auto cacheFile = "dataframe_resultcache_tree.root";
+   const auto inputFile = "dataframe_resultcache_tree_input.root";
+   gSystem->Unlink(cacheFile);
+   WriteTree(inputFile, 10);
+   for (auto expectedNRuns : {1u, 0u}) {
+      RDataFrame df("t", inputFile);
+      df.SetResultCache(cacheFile);
+      CheckResults(df, df, expectedNRuns);
+   }
+
+   // a modified input file invalidates the cached results
+   WriteTree(inputFile, 20);
+   RDataFrame df("t", inputFile);
+   df.SetResultCache(cacheFile);
+   EXPECT_EQ(*df.Count(), 20ull);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+
+   gSystem->Unlink(cacheFile);
+   gSystem->Unlink(inputFile);
+}
+
+TEST(RDFResultCache, InMemoryTree)
+{
+   const auto cacheFile = "dataframe_resultcache_inmemory.root";
+   gSystem->Unlink(cacheFile);
+   TTree t("t", "t");
+   double x = 0.;
+   t.Branch("x", &x);
+   for (int i = 0; i < 10; ++i) {
+      x = i;
+      t.Fill();
+   }
+   // the entries of in-memory trees cannot be identified across processes: results are always computed
+   for (int i = 0; i < 2; ++i) {
+      RDataFrame df(t);
+      df.SetResultCache(cacheFile);
+      CheckResults(df, df, 1u);
+   }
+   gSystem->Unlink(cacheFile);
+}
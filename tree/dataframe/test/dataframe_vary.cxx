@@ -0,0 +1,127 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RVec.hxx"
+#include "TH1D.h"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::RDataFrame;
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+// "x" takes values 0..9: the "down" and "up" variations shift it by -1 and +1
+static ROOT::RDF::RNode MakeVariedDF(RDataFrame &df)
+{
+   return df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+      .Vary("x", [](double x) { return RVec<double>{x - 1., x + 1.}; }, {"x"}, {"down", "up"}, "xvar");
+}
+
+static void CheckResults(RDataFrame &df)
+{
+   auto filtered = MakeVariedDF(df).Filter([](double x) { return x > 4.5; }, {"x"});
+   auto sum = filtered.Define("y", [](double x) { return 2. * x; }, {"x"}).Sum<double>("y");
+   auto count = filtered.Count();
+   auto histo = filtered.Histo1D<double>({"h", "h", 20, 0., 20.}, "x");
+
+   auto sums = VariationsFor(sum);
+   auto counts = VariationsFor(count);
+   auto histos = VariationsFor(histo);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "xvar:down", "xvar:up"}));
+   EXPECT_DOUBLE_EQ(sums["nominal"], 70.);
+   EXPECT_DOUBLE_EQ(sums["xvar:down"], 52.);
+   EXPECT_DOUBLE_EQ(sums["xvar:up"], 90.);
+   EXPECT_EQ(counts["nominal"], 5u);
+   EXPECT_EQ(counts["xvar:down"], 4u);
+   EXPECT_EQ(counts["xvar:up"], 6u);
+   EXPECT_EQ(histos["nominal"].GetEntries(), 5.);
+   EXPECT_EQ(histos["xvar:down"].GetEntries(), 4.);
+   EXPECT_EQ(histos["xvar:up"].GetEntries(), 6.);
+   EXPECT_DOUBLE_EQ(*sum, 70.);
+   EXPECT_EQ(df.GetNRuns(), 1u);
+   EXPECT_THROW(sums["xvar:sideways"], std::runtime_error);
+}
+
+TEST(RDFVary, SimpleSum)
+{
+   RDataFrame df(10);
+   CheckResults(df);
+}
+
+TEST(RDFVary, Bulk)
+{
+   RDataFrame df(10);
+   df.SetBulkSize(4);
+   CheckResults(df);
+}
+
+TEST(RDFVary, ResultsWithoutVariations)
+{
+   RDataFrame df(10);
+   auto d = MakeVariedDF(df);
+   auto counts = VariationsFor(d.Count());
+   EXPECT_EQ(counts.GetKeys(), std::vector<std::string>({"nominal"}));
+   EXPECT_EQ(counts["nominal"], 10u);
+}
+
+TEST(RDFVary, NVariations)
+{
+   RDataFrame df(10);
+   auto sum = df.Define("x", [] { return 1; })
+                 .Vary("x", [] { return RVec<int>{0, 1, 2}; }, {}, 3)
+                 .Sum<int>("x");
+   auto sums = VariationsFor(sum);
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:0", "x:1", "x:2"}));
+   EXPECT_EQ(sums["nominal"], 10);
+   EXPECT_EQ(sums["x:0"], 0);
+   EXPECT_EQ(sums["x:1"], 10);
+   EXPECT_EQ(sums["x:2"], 20);
+}
+
+TEST(RDFVary, JittedFilter)
+{
+   RDataFrame df(10);
+   auto count = MakeVariedDF(df).Filter("x > 4.5").Count();
+   auto counts = VariationsFor(count);
+   EXPECT_EQ(counts["nominal"], 5u);
+   EXPECT_EQ(counts["xvar:down"], 4u);
+   EXPECT_EQ(counts["xvar:up"], 6u);
+}
+
+TEST(RDFVary, WrongNumberOfValues)
+{
+   RDataFrame df(10);
+   auto sum = df.Define("x", [] { return 1; }).Vary("x", [] { return RVec<int>{0}; }, {}, {"down", "up"}).Sum<int>("x");
+   auto sums = VariationsFor(sum);
+   EXPECT_THROW(sums["x:up"], std::runtime_error);
+}
+
+TEST(RDFVary, InvalidVariations)
+{
+   RDataFrame df(10);
+   auto d = df.Define("x", [] { return 1; });
+   auto expr = [] { return RVec<int>{0, 1}; };
+   EXPECT_THROW(d.Vary("x", expr, {}, std::vector<std::string>{}), std::logic_error);
+   EXPECT_THROW(d.Vary("x", expr, {}, {"up", "up"}), std::logic_error);
+   EXPECT_THROW(d.Vary("y", expr, {}, {"down", "up"}), std::runtime_error);
+   auto varied = d.Vary("x", expr, {}, {"down", "up"});
+   EXPECT_THROW(varied.Vary("x", expr, {}, {"down", "up"}), std::logic_error);
+}
+
+TEST(RDFVary, VariationsForAfterRun)
+{
+   RDataFrame df(10);
+   auto sum = MakeVariedDF(df).Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum, 45.);
+   EXPECT_THROW(VariationsFor(sum), std::logic_error);
+}
+
+TEST(RDFVary, UnsupportedAction)
+{
+   RDataFrame df(10);
+   auto taken = MakeVariedDF(df).Take<double>("x");
+   EXPECT_THROW(VariationsFor(taken), std::logic_error);
+}
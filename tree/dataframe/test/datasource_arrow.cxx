@@ -2,12 +2,15 @@
 #include <ROOT/RArrowDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
 #endif
 #include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
 #include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
@@ -203,6 +206,72 @@ TEST(RArrowDS, FromARDFWithJitting)
    EXPECT_EQ(40, *min);
 }
 
+TEST(RArrowDS, RecordBatchReader)
+{
+   auto table = createTestTable();
+   auto batchReader = std::make_shared<arrow::TableBatchReader>(*table);
+   batchReader->set_chunksize(4); // batches of 4 and 2 entries
+   auto rdf = MakeArrowDataFrame(batchReader, {"Name", "Age"});
+   auto sum = rdf.Sum<Long64_t>("Age");
+   auto names = rdf.Take<std::string>("Name");
+
+   EXPECT_EQ(186, *sum);
+   ASSERT_EQ(6U, names->size());
+   EXPECT_EQ("Tom", names->at(3));
+   EXPECT_EQ(" Mary Ann ", names->at(5));
+   // the batches have been consumed by the first event loop
+   EXPECT_THROW(rdf.Count().GetValue(), std::runtime_error);
+}
+
+TEST(RArrowDS, RecordBatchReaderManyEntries)
+{
+   // more entries than the first group of record batches contains, read in a single-thread event loop
+   const auto nEntries = 100000;
+   std::vector<std::string> names;
+   std::vector<int64_t> ages;
+   for (auto i : ROOT::TSeqI(nEntries)) {
+      names.emplace_back("name" + std::to_string(i));
+      ages.emplace_back(i);
+   }
+   std::shared_ptr<Array> namesArray, agesArray;
+   arrow::ArrayFromVector<StringType, std::string>(names, &namesArray);
+   arrow::ArrayFromVector<Int64Type, int64_t>(ages, &agesArray);
+   auto schema_ = schema({field("Name", arrow::utf8()), field("Age", arrow::int64())});
+   auto table = Table::Make(schema_, std::vector<std::shared_ptr<Array>>{namesArray, agesArray});
+
+   auto batchReader = std::make_shared<arrow::TableBatchReader>(*table);
+   batchReader->set_chunksize(10000);
+   auto rdf = MakeArrowDataFrame(batchReader, {});
+   auto sum = rdf.Sum<Long64_t>("Age");
+   auto takenNames = rdf.Take<std::string>("Name");
+
+   EXPECT_EQ(Long64_t(nEntries) * (nEntries - 1) / 2, *sum);
+   ASSERT_EQ(names.size(), takenNames->size());
+   EXPECT_EQ(names, *takenNames);
+}
+
+TEST(RArrowDS, IPCFile)
+{
+   const auto fileName = "datasource_arrow_ipcfile.arrow";
+   auto table = createTestTable();
+   {
+      std::shared_ptr<arrow::io::FileOutputStream> out;
+      ASSERT_TRUE(arrow::io::FileOutputStream::Open(fileName, &out).ok());
+      std::shared_ptr<arrow::ipc::RecordBatchWriter> writer;
+      ASSERT_TRUE(arrow::ipc::RecordBatchFileWriter::Open(out.get(), table->schema(), &writer).ok());
+      ASSERT_TRUE(writer->WriteTable(*table, 4).ok()); // batches of 4 and 2 entries
+      ASSERT_TRUE(writer->Close().ok());
+      ASSERT_TRUE(out->Close().ok());
+   }
+
+   auto rdf = MakeArrowIPCDataFrame(fileName, {});
+   EXPECT_EQ(6U, *rdf.Count());
+   // the file is read again by the second event loop
+   EXPECT_DOUBLE_EQ(200.5, *rdf.Max<double>("Height"));
+
+   gSystem->Unlink(fileName);
+}
+
 // NOW MT!-------------
 #ifdef R__USE_IMT
 
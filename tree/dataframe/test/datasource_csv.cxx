@@ -2,9 +2,11 @@
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <iostream>
 
 using namespace ROOT::RDF;
@@ -194,6 +196,25 @@ TEST(RCsvDS, ProgressiveReadingRDF)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ProgressiveReadingValues)
+{
+   const auto fileName = "RCsvDS_test_progressive.csv";
+   {
+      std::ofstream f(fileName);
+      f << "x,s\r\n";
+      for (auto i : ROOT::TSeqI(1000))
+         f << i << ",\"a,\"\"" << i << "\"\"\"\r\n";
+   }
+   // the chunks of 7 lines do not divide the number of lines, and quoted fields must be unescaped
+   auto tdf = ROOT::RDF::MakeCsvDataFrame(fileName, true, ',', 7LL);
+   auto sum = tdf.Sum<Long64_t>("x");
+   auto strings = tdf.Take<std::string>("s");
+   EXPECT_EQ(499500LL, *sum);
+   ASSERT_EQ(1000U, strings->size());
+   EXPECT_EQ("a,\"999\"", strings->back());
+   gSystem->Unlink(fileName);
+}
+
 #ifndef NDEBUG
 
 TEST(RCsvDS, SetNSlotsTwice)
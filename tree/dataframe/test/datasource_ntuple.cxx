@@ -1,4 +1,5 @@
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/RNTupleSnapshot.hxx>
 #include <ROOT/RNTupleDS.hxx>
 
 #include <ROOT/RNTuple.hxx>
@@ -58,8 +59,9 @@ TEST_F(RNTupleDSTest, ColTypeNames)
 }
 
 
-void ReadTest(const std::string &name, const std::string &fname) {
+void ReadTest(const std::string &name, const std::string &fname, std::size_t bulkSize = 1) {
    auto df = ROOT::Experimental::MakeNTupleDataFrame(name, fname);
+   df.SetBulkSize(bulkSize);
 
    auto count = df.Count();
    auto sumpt = df.Sum<float>("pt");
@@ -87,6 +89,11 @@ TEST_F(RNTupleDSTest, Read)
    ReadTest(fNtplName, fFileName);
 }
 
+TEST_F(RNTupleDSTest, ReadBulk)
+{
+   ReadTest(fNtplName, fFileName, 16);
+}
+
 struct IMTRAII {
    IMTRAII() { ROOT::EnableImplicitMT(); }
    ~IMTRAII() { ROOT::DisableImplicitMT(); }
@@ -98,3 +105,189 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+class RNTupleDSChainTest : public ::testing::Test {
+protected:
+   std::string fNtplName = "ntuple";
+   std::vector<std::string> fFileNames{"RNTupleDS_chain_test_0.root", "RNTupleDS_chain_test_1.root",
+                                       "RNTupleDS_chain_test_2.root"};
+
+   void SetUp() override {
+      // File i holds i + 1 clusters with two entries each, so that the entries are 0, 1, ..., 11
+      int value = 0;
+      for (unsigned i = 0; i < fFileNames.size(); ++i) {
+         auto modelWrite = RNTupleModel::Create();
+         auto wrPt = modelWrite->MakeField<float>("pt");
+         auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), fNtplName, fFileNames[i]);
+         for (unsigned j = 0; j <= i; ++j) {
+            *wrPt = value++;
+            ntuple->Fill();
+            *wrPt = value++;
+            ntuple->Fill();
+            ntuple->CommitCluster();
+         }
+      }
+   }
+
+   void TearDown() override {
+      for (const auto &f : fFileNames)
+         std::remove(f.c_str());
+   }
+};
+
+TEST_F(RNTupleDSChainTest, EntryRanges)
+{
+   RNTupleDS ds(fNtplName, fFileNames);
+   ds.SetNSlots(1);
+   ds.Initialise();
+   // One range per cluster; ranges never cross file boundaries
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   std::vector<std::pair<ULong64_t, ULong64_t>> batch;
+   while (!(batch = ds.GetEntryRanges()).empty())
+      ranges.insert(ranges.end(), batch.begin(), batch.end());
+   std::vector<std::pair<ULong64_t, ULong64_t>> expected{{0, 2}, {2, 4}, {4, 6}, {6, 8}, {8, 10}, {10, 12}};
+   EXPECT_EQ(expected, ranges);
+
+   auto reader = ds.GetColumnReaders(0, "pt", typeid(float));
+   for (ULong64_t entry = 0; entry < 12; ++entry) {
+      EXPECT_TRUE(ds.SetEntry(0, entry));
+      EXPECT_FLOAT_EQ(float(entry), reader->Get<float>(entry));
+   }
+   ds.Finalise();
+}
+
+TEST_F(RNTupleDSChainTest, RevisitFile)
+{
+   RNTupleDS ds(fNtplName, fFileNames);
+   ds.SetNSlots(1);
+   ds.Initialise();
+   std::vector<std::pair<ULong64_t, ULong64_t>> batch;
+   while (!(batch = ds.GetEntryRanges()).empty()) {
+   }
+
+   // The slot jumps back and forth between the first and the last file, as with ranges processed out of order
+   auto reader = ds.GetColumnReaders(0, "pt", typeid(float));
+   for (ULong64_t entry : {0, 11, 1, 6, 10, 0}) {
+      EXPECT_TRUE(ds.SetEntry(0, entry));
+      EXPECT_FLOAT_EQ(float(entry), reader->Get<float>(entry));
+   }
+   ds.Finalise();
+}
+
+TEST_F(RNTupleDSChainTest, SchemaMismatch)
+{
+   const std::string fileName = "RNTupleDS_mismatch_test.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<double>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), fNtplName, fileName);
+      ntuple->Fill();
+   }
+   auto fileNames = fFileNames;
+   fileNames.emplace_back(fileName);
+   RNTupleDS ds(fNtplName, fileNames);
+   ds.SetNSlots(1);
+   ds.Initialise();
+   try {
+      while (!ds.GetEntryRanges().empty()) {
+      }
+      FAIL() << "a file with a different schema should throw";
+   } catch (const std::runtime_error &err) {
+      EXPECT_NE(std::string::npos, std::string(err.what()).find("has type double instead of float"));
+   }
+   std::remove(fileName.c_str());
+}
+
+void ChainTest(const std::string &name, const std::vector<std::string> &fileNames, std::size_t bulkSize = 1)
+{
+   auto df = ROOT::Experimental::MakeNTupleDataFrame(name, fileNames);
+   df.SetBulkSize(bulkSize);
+   auto count = df.Count();
+   auto sumpt = df.Sum<float>("pt");
+   auto minpt = df.Min<float>("pt");
+   auto maxpt = df.Max<float>("pt");
+   auto sumsq = df.Filter([](float pt) { return pt > 2.f; }, {"pt"})
+                   .Define("ptsq", [](float pt) { return pt * pt; }, {"pt"})
+                   .Sum<float>("ptsq");
+   EXPECT_EQ(12ull, count.GetValue());
+   EXPECT_FLOAT_EQ(66.f, sumpt.GetValue());
+   EXPECT_FLOAT_EQ(0.f, minpt.GetValue());
+   EXPECT_FLOAT_EQ(11.f, maxpt.GetValue());
+   EXPECT_FLOAT_EQ(501.f, sumsq.GetValue());
+}
+
+TEST_F(RNTupleDSChainTest, Read)
+{
+   ChainTest(fNtplName, fFileNames);
+   ChainTest(fNtplName, {"RNTupleDS_chain_test_*.root"});
+}
+
+TEST_F(RNTupleDSChainTest, ReadMT)
+{
+   IMTRAII _;
+
+   ChainTest(fNtplName, fFileNames);
+   ChainTest(fNtplName, {"RNTupleDS_chain_test_*.root"});
+}
+
+TEST_F(RNTupleDSChainTest, ReadBulk)
+{
+   // Bulks of 3 entries do not fit the ranges of 2 entries: they are cut at the range boundaries
+   ChainTest(fNtplName, fFileNames, 3);
+   ChainTest(fNtplName, fFileNames, 1024);
+}
+
+TEST_F(RNTupleDSChainTest, ReadBulkMT)
+{
+   IMTRAII _;
+
+   ChainTest(fNtplName, fFileNames, 3);
+}
+
+using ROOT::VecOps::RVec;
+
+void SnapshotTest(const std::string &fileName, ULong64_t nEntries)
+{
+   ROOT::RDataFrame df(nEntries);
+   auto d = df.Define("pt", [](ULong64_t e) { return double(e % 100); }, {"rdfentry_"})
+               .Define("jets", [](double pt) { return RVec<double>{pt, 2. * pt}; }, {"pt"});
+   auto out = ROOT::Experimental::SnapshotNTuple<double, RVec<double>>(d, "ntuple", fileName, {"pt", "jets"});
+
+   auto count = out->Count();
+   auto sumpt = out->Sum<double>("pt");
+   auto sumjets = out->Sum<RVec<double>>("jets");
+   const double expectedSum = (nEntries / 100) * 4950.;
+   EXPECT_EQ(*count, nEntries);
+   EXPECT_DOUBLE_EQ(*sumpt, expectedSum);
+   EXPECT_DOUBLE_EQ(*sumjets, 3. * expectedSum);
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleSnapshot, Basics)
+{
+   SnapshotTest("RNTupleSnapshot_test.root", 1000);
+}
+
+TEST(RNTupleSnapshot, MT)
+{
+   IMTRAII _;
+
+   // enough entries for several clusters per slot
+   SnapshotTest("RNTupleSnapshot_test_mt.root", 500000);
+}
+
+TEST(RNTupleSnapshot, Lazy)
+{
+   const std::string fileName = "RNTupleSnapshot_test_lazy.root";
+   ROOT::RDataFrame df(10);
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fLazy = true;
+   auto d = df.Define("x", [] { return 42.f; });
+   auto out = ROOT::Experimental::SnapshotNTuple<float>(d, "ntuple", fileName, {"x"}, opts);
+   EXPECT_FALSE(out.IsReady());
+   EXPECT_EQ(*out->Count(), 10u);
+   std::remove(fileName.c_str());
+
+   opts.fMode = "UPDATE";
+   EXPECT_THROW(ROOT::Experimental::SnapshotNTuple<float>(d, "ntuple", fileName, {"x"}, opts), std::runtime_error);
+}
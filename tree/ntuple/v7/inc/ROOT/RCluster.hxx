@@ -18,6 +18,7 @@
 
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
@@ -142,6 +143,25 @@ public:
    ~ROnDiskPageMapHeap();
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMapPool
+\ingroup NTuple
+\brief An ROnDiskPageMap whose fMemory is taken from and given back to the RPageAllocatorPool
+*/
+// clang-format on
+class ROnDiskPageMapPool : public ROnDiskPageMap {
+private:
+   /// The memory region containing the on-disk pages.
+   unsigned char *fMemory;
+   std::size_t fSize;
+public:
+   ROnDiskPageMapPool(unsigned char *memory, std::size_t size) : fMemory(memory), fSize(size) {}
+   ROnDiskPageMapPool(const ROnDiskPageMapPool &other) = delete;
+   ROnDiskPageMapPool &operator =(const ROnDiskPageMapPool &other) = delete;
+   ~ROnDiskPageMapPool();
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RCluster
@@ -152,13 +172,22 @@ Binds together several page maps that represent all the pages of certain columns
 */
 // clang-format on
 class RCluster {
+public:
+   using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+   /// The identifiers that specifies the content of a (possibly partial) cluster
+   struct RKey {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      ColumnSet_t fColumnSet;
+   };
+
 protected:
    /// References the cluster identifier in the page source that created the cluster
    DescriptorId_t fClusterId;
-   /// Multiple page maps can be combined in a single RCluster
-   std::vector<std::unique_ptr<ROnDiskPageMap>> fPageMaps;
+   /// Multiple page maps can be combined in a single RCluster.  The page maps are shared with the unzip tasks,
+   /// which can outlive the cluster's stay in the cluster pool.
+   std::vector<std::shared_ptr<ROnDiskPageMap>> fPageMaps;
    /// Set of the (complete) columns represented by the RCluster
-   std::unordered_set<DescriptorId_t> fAvailColumns;
+   ColumnSet_t fAvailColumns;
    /// Lookup table for the on-disk pages
    std::unordered_map<ROnDiskPage::Key, ROnDiskPage> fOnDiskPages;
 
@@ -187,9 +216,11 @@ public:
    const ROnDiskPage *GetOnDiskPage(const ROnDiskPage::Key &key) const;
 
    DescriptorId_t GetId() const { return fClusterId; }
-   const std::unordered_set<DescriptorId_t> &GetAvailColumns() const { return fAvailColumns; }
+   const ColumnSet_t &GetAvailColumns() const { return fAvailColumns; }
    bool ContainsColumn(DescriptorId_t columnId) const { return fAvailColumns.count(columnId) > 0; }
    size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   /// Holding a copy of the page maps keeps the memory of the on-disk pages alive
+   const std::vector<std::shared_ptr<ROnDiskPageMap>> &GetPageMaps() const { return fPageMaps; }
 };
 
 } // namespace Detail
@@ -17,6 +17,7 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx> // for ColumnSet_t
 
@@ -35,6 +36,41 @@ namespace Detail {
 
 class RPageSource;
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterEvictionPolicy
+\ingroup NTuple
+\brief Decides which clusters outside the read-ahead window are retained by the cluster pool
+
+Eviction policies are shared by the clones of a page source and therefore must not keep state.
+*/
+// clang-format on
+class RClusterEvictionPolicy {
+public:
+   virtual ~RClusterEvictionPolicy() = default;
+   /// Returns the clusters that should stay in the pool if they are present, in the order of decreasing priority.
+   /// If the pool runs out of memory, clusters are evicted from the end of the list.
+   virtual std::vector<DescriptorId_t> GetRetainedClusters(DescriptorId_t activeClusterId,
+                                                           const RNTupleDescriptor &desc) const = 0;
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterLookBackPolicy
+\ingroup NTuple
+\brief Retains the given number of clusters preceding the active cluster
+*/
+// clang-format on
+class RClusterLookBackPolicy : public RClusterEvictionPolicy {
+private:
+   unsigned int fNClusters;
+
+public:
+   explicit RClusterLookBackPolicy(unsigned int nClusters) : fNClusters(nClusters) {}
+   std::vector<DescriptorId_t> GetRetainedClusters(DescriptorId_t activeClusterId,
+                                                   const RNTupleDescriptor &desc) const final;
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RClusterPool
@@ -51,6 +87,9 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+If it is turned on, the unzip thread schedules a task per page and hands the cluster over to the main thread without
+waiting for the tasks.  The page source announces the pages to its page pool, so that a page can be used as soon as
+its task is done, possibly before the rest of the cluster is unzipped.
 */
 // clang-format on
 class RClusterPool {
@@ -89,13 +128,32 @@ private:
       bool operator <(const RInFlightCluster &other) const;
    };
 
+   /// Performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNClusterRequested;
+      RNTupleAtomicCounter &fNClusterHit;
+      RNTupleAtomicCounter &fNClusterScheduled;
+      RNTupleAtomicCounter &fNClusterEvicted;
+      RNTupleAtomicCounter &fNClusterDiscarded;
+      RNTupleAtomicCounter &fTimeWallWait;
+   };
+   /// Wraps the pool counters and is observed by the page source metrics. Needs to be constructed before the
+   /// I/O thread that uses the counters.
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
    /// Every cluster pool is responsible for exactly one page source that triggers loading of the clusters
    /// (GetCluster()) and is used for implementing the I/O and cluster memory allocation (PageSource::LoadCluster()).
    RPageSource &fPageSource;
-   /// The number of clusters before the currently active cluster that should stay in the pool if present
+   /// The number of clusters before the currently active cluster that should stay in the pool if present.
+   /// Only used if the pool is constructed with a fixed size; otherwise the eviction policy is given by the read options.
    unsigned int fWindowPre;
    /// The number of desired clusters in the pool, including the currently active cluster
    unsigned int fWindowPost;
+   /// Upper limit for the compressed size of the clusters in the pool and in flight; zero for no limit
+   std::size_t fMaxBytes = 0;
+   /// Decides which clusters preceding the active cluster or otherwise outside the read-ahead window are retained
+   std::shared_ptr<const RClusterEvictionPolicy> fEvictionPolicy;
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
 
@@ -115,7 +173,7 @@ private:
    /// The communication channel between the I/O thread and the unzip thread
    std::queue<RUnzipItem> fUnzipQueue;
 
-   /// The I/O thread calls RPageSource::LoadCluster() asynchronously.  The thread is mostly waiting for the
+   /// The I/O thread calls RPageSource::LoadClusters() asynchronously.  The thread is mostly waiting for the
    /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
    /// main threads.
    std::thread fThreadIo;
@@ -124,15 +182,18 @@ private:
    /// schedules the unzipping of pages using the application's task scheduler.
    std::thread fThreadUnzip;
 
+   /// Registers the pool counters in the given metrics object
+   static std::unique_ptr<RCounters> MakeCounters(RNTupleMetrics &metrics);
    /// Every cluster id has at most one corresponding RCluster pointer in the pool
    RCluster *FindInPool(DescriptorId_t clusterId) const;
-   /// Returns an index of an unused element in fPool; callers of this function (GetCluster() and WaitFor())
-   /// make sure that a free slot actually exists
-   size_t FindFreeSlot() const;
+   /// Returns an index of an unused element in fPool.  Retained clusters of the eviction policy can make the
+   /// pool exceed its initial size, in which case the pool grows.
+   size_t FindFreeSlot();
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
    /// The unzip thread routine which takes a loaded cluster and passes it to fPageSource.UnzipCluster (which
-   /// might be a no-op if IMT is off). Marks the cluster as ready to be picked up by the main thread.
+   /// might be a no-op if IMT is off). Marks the cluster as ready to be picked up by the main thread.  Waits for
+   /// the unzip tasks once the work queue is drained.
    void ExecUnzipClusters();
    /// Returns the given cluster from the pool, which needs to contain at least the columns `columns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
@@ -143,12 +204,16 @@ public:
    static constexpr unsigned int kDefaultPoolSize = 4;
    RClusterPool(RPageSource &pageSource, unsigned int size);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultPoolSize) {}
+   /// Sets the read-ahead window, the memory limit and the eviction policy from the read options
+   RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options);
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
    ~RClusterPool();
 
    unsigned int GetWindowPre() const { return fWindowPre; }
    unsigned int GetWindowPost() const { return fWindowPost; }
+   std::size_t GetMaxBytes() const { return fMaxBytes; }
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
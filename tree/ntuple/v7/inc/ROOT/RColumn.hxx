@@ -62,8 +62,13 @@ private:
    ColumnId_t fColumnIdSource;
    /// Used to pack and unpack pages on writing/reading
    std::unique_ptr<RColumnElementBase> fElement;
+   /// Creates the element for a column model given the in-memory type of the column, used when the on-disk
+   /// column model differs from the one requested by the field
+   std::unique_ptr<RColumnElementBase> (*fGenerateElement)(const RColumnModel &model) = nullptr;
 
    RColumn(const RColumnModel &model, std::uint32_t index);
+   /// When connected to a page source, switches the column model and the element to the stored column type
+   void AdoptOnDiskModel();
 
 public:
    template <typename CppT, EColumnType ColumnT>
@@ -71,6 +76,18 @@ public:
       R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      column->fGenerateElement = &RColumnElementBase::Generate<CppT>;
+      return column;
+   }
+
+   /// Creates a column whose on-disk type is only known at runtime, e.g. a column with a user-selected encoding.
+   /// The in-memory layout of the column elements has to be the one of CppT.
+   template <typename CppT>
+   static RColumn *Create(const RColumnModel &model, std::uint32_t index) {
+      auto column = new RColumn(model, index);
+      column->fElement = RColumnElementBase::Generate<CppT>(model);
+      column->fGenerateElement = &RColumnElementBase::Generate<CppT>;
+      R__ASSERT(column->fElement->GetSize() == sizeof(CppT));
       return column;
    }
 
@@ -178,6 +195,32 @@ public:
          (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
    }
 
+   /// Like Map() but additionally returns in nItems the number of elements, starting with the mapped one, that are
+   /// consecutive in memory.  These are the remaining elements of the page that contains the requested index.
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(globalIndex)) {
+         MapPage(globalIndex);
+      }
+      // +1 to go from 0-based indexing to 1-based number of items
+      nItems = fCurrentPage.GetGlobalRangeLast() - globalIndex + 1;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+         (globalIndex - fCurrentPage.GetGlobalRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
+   template <typename CppT, EColumnType ColumnT>
+   CppT *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      if (!fCurrentPage.Contains(clusterIndex)) {
+         MapPage(clusterIndex);
+      }
+      // +1 to go from 0-based indexing to 1-based number of items
+      nItems = fCurrentPage.GetClusterRangeLast() - clusterIndex.GetIndex() + 1;
+      return reinterpret_cast<CppT*>(
+         static_cast<unsigned char *>(fCurrentPage.GetBuffer()) +
+         (clusterIndex.GetIndex() - fCurrentPage.GetClusterRangeFirst()) * RColumnElement<CppT, ColumnT>::kSize);
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fCurrentPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
@@ -229,6 +272,10 @@ public:
    void MapPage(const RClusterIndex &clusterIndex);
    NTupleSize_t GetNElements() const { return fNElements; }
    RColumnElementBase *GetElement() const { return fElement.get(); }
+   /// Creates an element of the column's in-memory type for the given, e.g. on-disk, column model
+   std::unique_ptr<RColumnElementBase> GenerateElement(const RColumnModel &model) const {
+      return fGenerateElement(model);
+   }
    const RColumnModel &GetModel() const { return fModel; }
    std::uint32_t GetIndex() const { return fIndex; }
    ColumnId_t GetColumnIdSource() const { return fColumnIdSource; }
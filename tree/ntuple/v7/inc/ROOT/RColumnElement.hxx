@@ -21,8 +21,10 @@
 
 #include <TError.h>
 
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
 
@@ -52,6 +54,36 @@ protected:
    /// Size of the C++ value pointed to by fRawContent (not necessarily equal to the on-disk element size)
    std::size_t fSize;
 
+   /// Implements FindValueRange() for in-memory elements of type CppT that are read back as StorageT.  NaN values
+   /// are ignored.  Integers that cannot be represented exactly as double widen the range by one ulp.
+   template <typename CppT, typename StorageT = CppT>
+   static bool FindValueRangeOf(const void *src, std::size_t count, double &min, double &max)
+   {
+      auto values = reinterpret_cast<const CppT *>(src);
+      bool hasValue = false;
+      StorageT vMin = StorageT();
+      StorageT vMax = StorageT();
+      for (std::size_t i = 0; i < count; ++i) {
+         auto v = static_cast<StorageT>(values[i]);
+         if (v != v)
+            continue;
+         if (!hasValue || v < vMin)
+            vMin = v;
+         if (!hasValue || v > vMax)
+            vMax = v;
+         hasValue = true;
+      }
+      if (!hasValue)
+         return false;
+      min = static_cast<double>(vMin);
+      max = static_cast<double>(vMax);
+      if (std::numeric_limits<StorageT>::digits > std::numeric_limits<double>::digits) {
+         min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+         max = std::nextafter(max, std::numeric_limits<double>::infinity());
+      }
+      return true;
+   }
+
 public:
    RColumnElementBase()
      : fRawContent(nullptr)
@@ -70,6 +102,14 @@ public:
    virtual ~RColumnElementBase() = default;
 
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Generates the element for the given column model and the in-memory type CppT.  Needed for column types
+   /// that can be used with several C++ types, such as reduced precision floating point columns, and for column
+   /// types that take parameters from the column model, such as the value range of quantized columns.
+   template <typename CppT>
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model)
+   {
+      return Generate(model.GetType());
+   }
    static std::size_t GetBitsOnStorage(EColumnType type);
 
    /// Write one or multiple column elements into destination
@@ -98,10 +138,47 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Derived, typed classes of numeric in-memory types set min and max to the value range of count in-memory
+   /// elements as they will be read back from storage.  Used for the page statistics.  Returns false if the
+   /// elements have no such range, e.g. for reduced precision columns or if all the values are NaN.
+   virtual bool FindValueRange(const void * /* src */, std::size_t /* count */, double & /* min */,
+                               double & /* max */) const
+   {
+      return false;
+   }
+
    void *GetRawContent() const { return fRawContent; }
    std::size_t GetSize() const { return fSize; }
 };
 
+template <>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<float>(const RColumnModel &model);
+template <>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<double>(const RColumnModel &model);
+
+/**
+ * Common base of the reduced precision floating point elements, which can optionally quantize into a value range
+ */
+class RColumnElementReducedPrecision : public RColumnElementBase {
+private:
+   bool fHasValueRange = false;
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
+
+public:
+   RColumnElementReducedPrecision(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   void SetValueRange(double min, double max)
+   {
+      fHasValueRange = true;
+      fValueMin = min;
+      fValueMax = max;
+   }
+   bool HasValueRange() const { return fHasValueRange; }
+   double GetValueMin() const { return fValueMin; }
+   double GetValueMax() const { return fValueMax; }
+};
+
 /**
  * Pairs of C++ type and column type, like float and EColumnType::kReal32
  */
@@ -126,6 +203,10 @@ public:
    explicit RColumnElement(float *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<float>(src, count, min, max);
+   }
 };
 
 template <>
@@ -137,6 +218,10 @@ public:
    explicit RColumnElement(double *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<double>(src, count, min, max);
+   }
 };
 
 template <>
@@ -148,6 +233,10 @@ public:
    explicit RColumnElement(std::uint8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::uint8_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -159,6 +248,10 @@ public:
    explicit RColumnElement(std::int32_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::int32_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -170,6 +263,10 @@ public:
    explicit RColumnElement(std::uint32_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::uint32_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -181,6 +278,10 @@ public:
    explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::int64_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -192,6 +293,10 @@ public:
    explicit RColumnElement(std::uint64_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::uint64_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -236,6 +341,206 @@ public:
    explicit RColumnElement(bool *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<bool>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kSplitReal64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(double *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<double>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kSplitReal32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(float *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<float>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitInt64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::int64_t>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitInt32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::int32_t>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kDeltaIndex> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(ROOT::Experimental::ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kZigzagInt64> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::int64_t>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kZigzagInt32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<std::int32_t>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal32> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = 32;
+   explicit RColumnElement(double *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool FindValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRangeOf<double, float>(src, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal16> : public RColumnElementReducedPrecision {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = 16;
+   explicit RColumnElement(float *value) : RColumnElementReducedPrecision(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal16> : public RColumnElementReducedPrecision {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = 16;
+   explicit RColumnElement(double *value) : RColumnElementReducedPrecision(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal8> : public RColumnElementReducedPrecision {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = 8;
+   explicit RColumnElement(float *value) : RColumnElementReducedPrecision(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal8> : public RColumnElementReducedPrecision {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = 8;
+   explicit RColumnElement(double *value) : RColumnElementReducedPrecision(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 
    void Pack(void *dst, void *src, std::size_t count) const final;
    void Unpack(void *dst, void *src, std::size_t count) const final;
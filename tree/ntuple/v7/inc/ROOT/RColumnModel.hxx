@@ -31,6 +31,7 @@ namespace Experimental {
 
 More complex types, such as classes, get translated into columns of such simple types by the RField.
 New types need to be accounted for in RColumnElementBase::Generate() and RColumnElementBase::GetBitsOnStorage(), too.
+The column type is stored on disk, so new types have to be appended at the end.
 */
 // clang-format on
 enum class EColumnType {
@@ -44,11 +45,31 @@ enum class EColumnType {
    kBit,
    kReal64,
    kReal32,
+   // Reduced precision floating point numbers.  Without a value range, kReal16 stores IEEE 754 half-precision
+   // floats and kReal8 stores the upper byte of a half-precision float (5 bit exponent, 2 bit mantissa).  With a
+   // value range (see RColumnModel::SetValueRange()), the numbers are linearly quantized over [min, max] into 16bit
+   // or 8bit unsigned integers.
    kReal16,
    kReal8,
    kInt64,
    kInt32,
    kInt16,
+   // Split encodings store the byte planes of a page one after another: first the least significant bytes of all
+   // the elements, then the second bytes, and so on.  That yields better compression for, e.g., floating point
+   // values with similar exponents.  In memory, the columns are identical to their non-split counterparts.
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   // Delta encoding of kIndex columns: within a page, every offset is stored as the difference to its predecessor
+   // (the first element as is), split into byte planes.  Collection sizes are usually small, so that the higher
+   // byte planes are mostly zero and compress very well.
+   kDeltaIndex,
+   // Zigzag encoding of signed integers, split into byte planes.  Zigzag maps integers of small absolute value
+   // to small unsigned integers (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...), which keeps the higher byte planes at zero
+   // for small negative numbers, too.
+   kZigzagInt64,
+   kZigzagInt32,
 };
 
 // clang-format off
@@ -62,6 +83,10 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// Only used by reduced precision floating point columns (kReal16, kReal8)
+   bool fHasValueRange = false;
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
@@ -70,8 +95,19 @@ public:
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
 
+   /// Quantize the values of a reduced precision floating point column into the range [min, max]
+   void SetValueRange(double min, double max) {
+      fHasValueRange = true;
+      fValueMin = min;
+      fValueMax = max;
+   }
+   bool HasValueRange() const { return fHasValueRange; }
+   double GetValueMin() const { return fValueMin; }
+   double GetValueMax() const { return fValueMax; }
+
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fHasValueRange == other.fHasValueRange) &&
+             (fValueMin == other.fValueMin) && (fValueMax == other.fValueMax);
    }
 };
 
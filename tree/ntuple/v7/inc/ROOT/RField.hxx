@@ -85,6 +85,10 @@ private:
    std::size_t fNRepetitions;
    /// A field on a trivial type that maps as-is to a single column
    bool fIsSimple;
+   /// The user-selected on-disk type of the principal column; kUnknown for the field's default column type
+   EColumnType fColumnType = EColumnType::kUnknown;
+   /// Set by RFieldFuse once the field's columns are connected to a page storage
+   bool fIsConnected = false;
 
 protected:
    /// Collections and classes own sub fields
@@ -98,8 +102,13 @@ protected:
    /// The columns are connected either to a sink or to a source (not to both); they are owned by the field.
    std::vector<std::unique_ptr<RColumn>> fColumns;
 
+   /// Called by Clone(); the derived classes copy their own settings and their sub fields
+   virtual std::unique_ptr<RFieldBase> CloneImpl(std::string_view newName) const = 0;
    /// Creates the backing columns corresponsing to the field type and name
    virtual void GenerateColumnsImpl() = 0;
+   /// The on-disk types that can be used for the principal column; the first one is the default.  Fields whose
+   /// principal column type cannot be changed return an empty list.
+   virtual std::vector<EColumnType> GetSupportedColumnTypes() const { return {}; }
 
    /// Operations on values of complex types, e.g. ones that involve multiple columns or for which no direct
    /// column type exists.
@@ -153,8 +162,9 @@ public:
    RFieldBase& operator =(RFieldBase&&) = default;
    virtual ~RFieldBase();
 
-   ///// Copies the field and its sub fields using a possibly new name and a new, unconnected set of columns
-   virtual std::unique_ptr<RFieldBase> Clone(std::string_view newName) const = 0;
+   /// Copies the field and its sub fields using a possibly new name and a new, unconnected set of columns.
+   /// Settings of the field, such as the selected column type, are copied as well.
+   std::unique_ptr<RFieldBase> Clone(std::string_view newName) const;
 
    /// Factory method to resurrect a field from the stored on-disk type information
    static RResult<std::unique_ptr<RFieldBase>> Create(const std::string &fieldName, const std::string &typeName);
@@ -223,6 +233,14 @@ public:
    const RFieldBase *GetParent() const { return fParent; }
    std::vector<const RFieldBase *> GetSubFields() const;
    bool IsSimple() const { return fIsSimple; }
+   bool IsConnected() const { return fIsConnected; }
+
+   /// Selects an alternative on-disk type for the principal column, e.g. a split encoding of a floating point
+   /// column.  Has to be called before the field is connected to a page sink.  Throws if the field does not support
+   /// the given column type.  When reading, the column type is taken from the ntuple meta-data.
+   void SetColumnType(EColumnType type);
+   /// Returns the user-selected type of the principal column or the default column type of the field
+   EColumnType GetColumnType() const;
 
    /// Indicates an evolution of the mapping scheme from C++ type to columns
    virtual RNTupleVersion GetFieldVersion() const { return RNTupleVersion(); }
@@ -258,9 +276,11 @@ public:
 
 /// The container field for an ntuple model, which itself has no physical representation
 class RFieldZero : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+
 public:
    RFieldZero() : Detail::RFieldBase("", "", ENTupleStructure::kRecord, false /* isSimple */) { }
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const;
 
    void GenerateColumnsImpl() final {}
    using Detail::RFieldBase::GenerateValue;
@@ -280,6 +300,7 @@ private:
    std::size_t fMaxAlignment = 1;
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
    void AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void ReadInClusterImpl(const RClusterIndex &clusterIndex, Detail::RFieldValue *value) final;
@@ -289,7 +310,6 @@ public:
    RClassField(RClassField&& other) = default;
    RClassField& operator =(RClassField&& other) = default;
    ~RClassField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final;
 
    void GenerateColumnsImpl() final;
    using Detail::RFieldBase::GenerateValue;
@@ -309,6 +329,10 @@ private:
    ClusterSize_t fNWritten;
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
    void AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
@@ -317,7 +341,6 @@ public:
    RVectorField(RVectorField&& other) = default;
    RVectorField& operator =(RVectorField&& other) = default;
    ~RVectorField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final;
 
    void GenerateColumnsImpl() final;
    using Detail::RFieldBase::GenerateValue;
@@ -345,6 +368,7 @@ private:
    std::size_t fArrayLength;
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
    void AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void ReadInClusterImpl(const RClusterIndex &clusterIndex, Detail::RFieldValue *value) final;
@@ -354,7 +378,6 @@ public:
    RArrayField(RArrayField &&other) = default;
    RArrayField& operator =(RArrayField &&other) = default;
    ~RArrayField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final;
 
    void GenerateColumnsImpl() final;
    using Detail::RFieldBase::GenerateValue;
@@ -384,6 +407,7 @@ private:
    void SetTag(void *variantPtr, std::uint32_t tag) const;
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
    void AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
@@ -393,7 +417,6 @@ public:
    RVariantField(RVariantField &&other) = default;
    RVariantField& operator =(RVariantField &&other) = default;
    ~RVariantField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final;
 
    void GenerateColumnsImpl() final;
    using Detail::RFieldBase::GenerateValue;
@@ -433,6 +456,13 @@ class RCollectionField : public ROOT::Experimental::Detail::RFieldBase {
 private:
    /// Save the link to the collection ntuple in order to reset the offset counter when committing the cluster
    std::shared_ptr<RCollectionNTuple> fCollectionNTuple;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
+
 public:
    static std::string TypeName() { return ":RCollectionField:"; }
    RCollectionField(std::string_view name,
@@ -441,7 +471,6 @@ public:
    RCollectionField(RCollectionField&& other) = default;
    RCollectionField& operator =(RCollectionField&& other) = default;
    ~RCollectionField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final;
 
    void GenerateColumnsImpl() final;
 
@@ -465,6 +494,14 @@ public:
 
 template <>
 class RField<ClusterSize_t> : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
+
 public:
    static std::string TypeName() { return "ROOT::Experimental::ClusterSize_t"; }
    explicit RField(std::string_view name)
@@ -472,9 +509,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -484,6 +518,12 @@ public:
    ClusterSize_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<ClusterSize_t, EColumnType::kIndex>(clusterIndex);
    }
+   ClusterSize_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(globalIndex, nItems);
+   }
+   ClusterSize_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<ClusterSize_t, EColumnType::kIndex>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -513,6 +553,11 @@ public:
 
 template <>
 class RField<bool> : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+
 public:
    static std::string TypeName() { return "bool"; }
    explicit RField(std::string_view name)
@@ -520,9 +565,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -532,6 +574,12 @@ public:
    bool *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<bool, EColumnType::kBit>(clusterIndex);
    }
+   bool *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(globalIndex, nItems);
+   }
+   bool *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<bool, EColumnType::kBit>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -552,6 +600,23 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   bool fHasValueRange = false;
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fHasValueRange = fHasValueRange;
+      clone->fValueMin = fValueMin;
+      clone->fValueMax = fValueMax;
+      return clone;
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kReal32, EColumnType::kSplitReal32, EColumnType::kReal16, EColumnType::kReal8};
+   }
+
 public:
    static std::string TypeName() { return "float"; }
    explicit RField(std::string_view name)
@@ -559,18 +624,26 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
+   /// For the reduced precision column types kReal16 and kReal8, quantize the values linearly into [min, max]
+   /// instead of storing them as (truncated) half-precision floats.  Values outside the range are clamped.
+   /// Has to be called before the field is connected to a page sink.
+   void SetValueRange(double min, double max);
+
    float *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<float, EColumnType::kReal32>(globalIndex);
    }
    float *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<float, EColumnType::kReal32>(clusterIndex);
    }
+   float *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(globalIndex, nItems);
+   }
+   float *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<float, EColumnType::kReal32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -592,6 +665,24 @@ public:
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   bool fHasValueRange = false;
+   double fValueMin = 0.0;
+   double fValueMax = 0.0;
+
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fHasValueRange = fHasValueRange;
+      clone->fValueMin = fValueMin;
+      clone->fValueMax = fValueMax;
+      return clone;
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kReal64, EColumnType::kSplitReal64, EColumnType::kReal32, EColumnType::kReal16,
+              EColumnType::kReal8};
+   }
+
 public:
    static std::string TypeName() { return "double"; }
    explicit RField(std::string_view name)
@@ -599,18 +690,26 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
+   /// For the reduced precision column types kReal16 and kReal8, quantize the values linearly into [min, max]
+   /// instead of storing them as (truncated) half-precision floats.  Values outside the range are clamped.
+   /// Has to be called before the field is connected to a page sink.
+   void SetValueRange(double min, double max);
+
    double *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<double, EColumnType::kReal64>(globalIndex);
    }
    double *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<double, EColumnType::kReal64>(clusterIndex);
    }
+   double *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(globalIndex, nItems);
+   }
+   double *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<double, EColumnType::kReal64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -631,6 +730,11 @@ public:
 
 template <>
 class RField<std::uint8_t> : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+
 public:
    static std::string TypeName() { return "std::uint8_t"; }
    explicit RField(std::string_view name)
@@ -638,9 +742,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -650,6 +751,12 @@ public:
    std::uint8_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint8_t, EColumnType::kByte>(clusterIndex);
    }
+   std::uint8_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(globalIndex, nItems);
+   }
+   std::uint8_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint8_t, EColumnType::kByte>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -670,6 +777,14 @@ public:
 
 template <>
 class RField<std::int32_t> : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kInt32, EColumnType::kSplitInt32, EColumnType::kZigzagInt32};
+   }
+
 public:
    static std::string TypeName() { return "std::int32_t"; }
    explicit RField(std::string_view name)
@@ -677,9 +792,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -689,6 +801,12 @@ public:
    std::int32_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::int32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::int32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::int32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::int32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -709,6 +827,14 @@ public:
 
 template <>
 class RField<std::uint32_t> : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kInt32, EColumnType::kSplitInt32};
+   }
+
 public:
    static std::string TypeName() { return "std::uint32_t"; }
    explicit RField(std::string_view name)
@@ -716,9 +842,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -728,6 +851,12 @@ public:
    std::uint32_t *Map(const RClusterIndex clusterIndex) {
       return fPrincipalColumn->Map<std::uint32_t, EColumnType::kInt32>(clusterIndex);
    }
+   std::uint32_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(globalIndex, nItems);
+   }
+   std::uint32_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint32_t, EColumnType::kInt32>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -748,6 +877,14 @@ public:
 
 template <>
 class RField<std::uint64_t> : public Detail::RFieldBase {
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kInt64, EColumnType::kSplitInt64};
+   }
+
 public:
    static std::string TypeName() { return "std::uint64_t"; }
    explicit RField(std::string_view name)
@@ -755,9 +892,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -767,6 +901,12 @@ public:
    std::uint64_t *Map(const RClusterIndex &clusterIndex) {
       return fPrincipalColumn->Map<std::uint64_t, EColumnType::kInt64>(clusterIndex);
    }
+   std::uint64_t *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(globalIndex, nItems);
+   }
+   std::uint64_t *MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
+      return fPrincipalColumn->MapV<std::uint64_t, EColumnType::kInt64>(clusterIndex, nItems);
+   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -796,6 +936,14 @@ private:
    void ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex,
                        ROOT::Experimental::Detail::RFieldValue *value) final;
 
+protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
+
 public:
    static std::string TypeName() { return "std::string"; }
    explicit RField(std::string_view name)
@@ -804,9 +952,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    void GenerateColumnsImpl() final;
 
@@ -938,6 +1083,12 @@ private:
    ClusterSize_t fNWritten{0};
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
    void AppendImpl(const Detail::RFieldValue& value) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
    void GenerateColumnsImpl() final;
@@ -948,9 +1099,6 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
 
    using Detail::RFieldBase::GenerateValue;
    template <typename... ArgsT>
@@ -992,6 +1140,13 @@ private:
    ClusterSize_t fNWritten;
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
+      return std::make_unique<RField<ROOT::VecOps::RVec<ItemT>>>(newName, std::move(newItemField));
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
    void AppendImpl(const Detail::RFieldValue& value) final {
       auto typedValue = value.Get<ContainerT>();
       auto count = typedValue->size();
@@ -1030,15 +1185,10 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
-      return std::make_unique<RField<ROOT::VecOps::RVec<ItemT>>>(newName, std::move(newItemField));
-   }
 
    void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      RColumnModel modelIndex(GetColumnType(), true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(modelIndex, 0)));
       fPrincipalColumn = fColumns[0].get();
    }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
@@ -1082,6 +1232,12 @@ private:
    ClusterSize_t fNWritten{0};
 
 protected:
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
+      return std::make_unique<RField<ROOT::VecOps::RVec<bool>>>(newName);
+   }
+   std::vector<EColumnType> GetSupportedColumnTypes() const final {
+      return {EColumnType::kIndex, EColumnType::kDeltaIndex};
+   }
    void AppendImpl(const Detail::RFieldValue& value) final {
       auto typedValue = value.Get<ContainerT>();
       auto count = typedValue->size();
@@ -1117,14 +1273,10 @@ public:
    RField(RField&& other) = default;
    RField& operator =(RField&& other) = default;
    ~RField() = default;
-   std::unique_ptr<Detail::RFieldBase> Clone(std::string_view newName) const final {
-      return std::make_unique<RField<ROOT::VecOps::RVec<bool>>>(newName);
-   }
 
    void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      RColumnModel modelIndex(GetColumnType(), true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(modelIndex, 0)));
       fPrincipalColumn = fColumns[0].get();
    }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
@@ -24,6 +24,7 @@
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <vector>
 
 class TCollection;
 class TFile;
@@ -145,8 +146,9 @@ private:
       TFile *fFile = nullptr;
       /// Low-level writing using a TFile
       void Write(const void *buffer, size_t nbytes, std::int64_t offset);
-      /// Writes an RBlob opaque key with the provided buffer as data record and returns the offset of the record
-      std::uint64_t WriteKey(const void *buffer, size_t nbytes, size_t len);
+      /// Writes an RBlob opaque key with the provided buffer as data record and returns the offset of the record.
+      /// The offset of the record is a multiple of alignment.
+      std::uint64_t WriteKey(const void *buffer, size_t nbytes, size_t len, std::size_t alignment = 1);
       operator bool() const { return fFile; }
    };
 
@@ -165,8 +167,17 @@ private:
       RFileSimple &operator =(RFileSimple &&other) = delete;
       ~RFileSimple();
 
+      /// A memory area to be written by WriteV()
+      struct RWriteBuffer {
+         const void *fBuffer = nullptr;
+         std::size_t fSize = 0;
+      };
+
       /// Writes bytes in the open stream, either at fFilePos or at the given offset
       void Write(const void *buffer, size_t nbytes, std::int64_t offset = -1);
+      /// Writes the buffers back-to-back at fFilePos.  On POSIX systems, the stream is flushed and the buffers are
+      /// written with vector writes (writev) on the underlying file descriptor, which saves a system call per buffer.
+      void WriteV(const std::vector<RWriteBuffer> &buffers);
       /// Writes a TKey including the data record, given by buffer, into fFile; returns the file offset to the payload.
       /// The payload is already compressed
       std::uint64_t WriteKey(const void *buffer, std::size_t nbytes, std::size_t len, std::int64_t offset = -1,
@@ -223,6 +234,20 @@ public:
    std::uint64_t WriteNTupleFooter(const void *data, size_t nbytes, size_t lenFooter);
    /// Writes a new record as an RBlob key into the file
    std::uint64_t WriteBlob(const void *data, size_t nbytes, size_t len);
+   /// A record to be written by WriteBlobV()
+   struct RBlobRequest {
+      const void *fData = nullptr;
+      std::size_t fNBytes = 0;
+      std::size_t fLen = 0;
+      /// The file offset of the record is made a multiple of fAlignment (at most 64) by padding the key header
+      std::size_t fAlignment = 1;
+      /// Set by WriteBlobV() to the file offset of the record
+      std::uint64_t fOffset = 0;
+   };
+   /// Writes the records in the given order, with the same result as repeated calls to WriteBlob() for records
+   /// without alignment.  When writing through a C file stream, the key headers and the records are written by a
+   /// single vector write.
+   void WriteBlobV(std::vector<RBlobRequest> &requests);
    /// Writes the RNTuple key to the file so that the header and footer keys can be found
    void Commit();
 };
@@ -82,6 +82,12 @@ An input ntuple provides data from storage as C++ objects. The ntuple model can
 or it can be imposed by the user. The latter case allows users to read into a specialized ntuple model that covers
 only a subset of the fields in the ntuple. The ntuple model is used when reading complete entries.
 Individual fields can be read as well by instantiating a tree view.
+
+Columns are activated on demand: the fields of the model are connected to the page source only once they are read
+through an entry, and views connect only the columns of the viewed field and its sub fields.  Only the active
+columns are loaded from storage, so that reading a few fields of a wide ntuple does not load the pages of all the
+other fields.  Entries covering a subset of the model's fields can be composed with REntry::AddValue() from the
+values generated by the model's fields.
 */
 // clang-format on
 class RNTupleReader {
@@ -97,7 +103,10 @@ private:
    /// Set as the page source's scheduler for parallel page decompression if IMT is on
    RNTupleImtTaskScheduler fUnzipTasks;
 
-   void ConnectModel(const RNTupleModel &model);
+   /// Checks that all the fields of a user-imposed model exist in the ntuple; the fields are connected on first use
+   void VerifyModel(const RNTupleModel &model);
+   /// Connects a top-level field of the model and its sub fields to the page source
+   void ConnectField(Detail::RFieldBase &field);
    RNTupleReader *GetDisplayReader();
    void InitPageSource();
 
@@ -161,13 +170,14 @@ public:
    /// Fills a user provided entry after checking that the entry has been instantiated from the ntuple model
    void LoadEntry(NTupleSize_t index, REntry &entry) {
       // TODO(jblomer): can be templated depending on the factory method / constructor
-      if (R__unlikely(!fModel)) {
+      if (R__unlikely(!fModel))
          fModel = fSource->GetDescriptor().GenerateModel();
-         ConnectModel(*fModel);
-      }
 
       for (auto& value : entry) {
-         value.GetField()->Read(index, &value);
+         auto field = value.GetField();
+         if (R__unlikely(!field->IsConnected()))
+            ConnectField(*field);
+         field->Read(index, &value);
       }
    }
 
@@ -214,6 +224,8 @@ private:
    NTupleSize_t fClusterSizeEntries;
    NTupleSize_t fLastCommitted;
    NTupleSize_t fNEntries;
+   /// Set as the page sink's scheduler for parallel page compression if IMT is on and the write options ask for it
+   RNTupleImtTaskScheduler fZipTasks;
 
 public:
    static std::unique_ptr<RNTupleWriter> Recreate(std::unique_ptr<RNTupleModel> model,
@@ -29,6 +29,7 @@
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -167,6 +168,26 @@ public:
       }
    };
 
+   /// Optional summary of the values of a column in a page or in a cluster.  Readers use it to skip pages and
+   /// clusters that cannot match a range predicate.  For numeric columns, the range refers to the values as they
+   /// are read back.  For the offset columns of collections, the range refers to the collection sizes and fNNull
+   /// counts the empty collections.
+   struct RStatistics {
+      bool fHasRange = false;
+      double fMin = 0.0;
+      double fMax = 0.0;
+      std::uint64_t fNNull = 0;
+
+      bool operator==(const RStatistics &other) const {
+         return fHasRange == other.fHasRange && fMin == other.fMin && fMax == other.fMax && fNNull == other.fNNull;
+      }
+
+      /// Adds the statistics of another page or cluster; the range is only kept if both sides have one
+      void Merge(const RStatistics &other);
+      /// False only if all the values are known to be outside [min, max]
+      bool MayOverlap(double min, double max) const { return !fHasRange || (fMin <= max && fMax >= min); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -177,13 +198,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The combined statistics of the pages of the column in the cluster
+      RStatistics fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -200,11 +221,19 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RLocator fLocator;
+         RStatistics fStatistics;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fStatistics == other.fStatistics;
          }
       };
+      /// The page info of a page found by Find() together with its position in the cluster
+      struct RPageInfoExtended : RPageInfo {
+         /// Index (in cluster) of the first element of the page
+         ClusterSize_t::ValueType fFirstInPage = 0;
+         /// Index of the page in fPageInfos
+         NTupleSize_t fPageNo = 0;
+      };
 
       RPageRange() = default;
       RPageRange(const RPageRange &other) = delete;
@@ -214,10 +243,16 @@ public:
 
       DescriptorId_t fColumnId = kInvalidDescriptorId;
       std::vector<RPageInfo> fPageInfos;
+      /// Running sum of the page sizes: entry i is the index (in cluster) of the first element after page i.
+      /// Filled by RNTupleDescriptorBuilder::AddClusterPageRange(); derived from fPageInfos and thus not compared.
+      std::vector<ClusterSize_t::ValueType> fCumulativeNElements;
 
       bool operator==(const RPageRange &other) const {
          return fColumnId == other.fColumnId && fPageInfos == other.fPageInfos;
       }
+
+      /// Binary search for the page that contains the element idxInCluster
+      RPageInfoExtended Find(ClusterSize_t::ValueType idxInCluster) const;
    };
 
 private:
@@ -305,6 +340,8 @@ private:
    /// May contain only a subset of all the available clusters, e.g. the clusters of the current file
    /// from a chain of files
    std::unordered_map<DescriptorId_t, RClusterDescriptor> fClusterDescriptors;
+   /// Whether the footer carries the value statistics of the pages and of the column ranges
+   bool fHasStatistics = true;
 
 public:
    // clang-format off
@@ -507,6 +544,8 @@ public:
    std::size_t GetNFields() const { return fFieldDescriptors.size(); }
    std::size_t GetNColumns() const { return fColumnDescriptors.size(); }
    std::size_t GetNClusters() const { return fClusterDescriptors.size(); }
+   /// If false, the statistics of all the pages and column ranges are empty
+   bool HasStatistics() const { return fHasStatistics; }
 
    // The number of entries as seen with the currently loaded cluster meta-data; there might be more
    NTupleSize_t GetNEntries() const;
@@ -521,6 +560,16 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the ascending entry ranges [first, last) of all the clusters; empty clusters are skipped
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> GetClusterEntryRanges() const;
+   /// Returns the ids of the clusters, ordered by their first entry, whose statistics of the given column do not
+   /// rule out values in [min, max].  Clusters without statistics are always returned.
+   std::vector<DescriptorId_t> FindClustersInRange(DescriptorId_t columnId, double min, double max) const;
+   /// Like FindClustersInRange() but on the level of pages.  Returns the ascending ranges [first, last) of element
+   /// indexes of the given column that may hold values in [min, max]; adjacent pages are joined into one range.
+   /// For columns of top-level fields, element indexes are entry numbers.
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>>
+   FindElementRangesInRange(DescriptorId_t columnId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
@@ -639,6 +688,7 @@ public:
    void AddCluster(DescriptorId_t clusterId, RNTupleVersion version,
                    NTupleSize_t firstEntryIndex, ClusterSize_t nEntries);
    void SetClusterLocator(DescriptorId_t clusterId, RClusterDescriptor::RLocator locator);
+   void SetHasStatistics(bool hasStatistics) { fDescriptor.fHasStatistics = hasStatistics; }
    void AddClusterColumnRange(DescriptorId_t clusterId, const RClusterDescriptor::RColumnRange &columnRange);
    void AddClusterPageRange(DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange);
 
@@ -19,6 +19,9 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +41,31 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the clusters of several ntuples with the same schema into a single ntuple
+
+The pages of the input ntuples are copied as they are stored, i.e. without decompressing and unpacking them, if the
+compression settings of the input cluster match the write options of the destination.  Otherwise, pages are
+decompressed and recompressed but still not unpacked.  Only the descriptor and the page locations are rewritten.
+All the sources need to have the same fields and the same column representations.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Maps the column ids of the destination to the column ids of the given source.  Throws if the schema of the
+   /// source does not match the destination.
+   static std::vector<DescriptorId_t> MapColumns(const RNTupleDescriptor &destination,
+                                                 const RNTupleDescriptor &source);
+
+public:
+   /// Attaches the sources, creates the destination from the schema of the first source, and appends the clusters
+   /// of all the sources in the given order to the destination.  Commits the dataset of the destination.
+   void Merge(const std::vector<Detail::RPageSource *> &sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -23,13 +23,16 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <ctime> // for CPU time measurement with clock()
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -70,6 +73,8 @@ public:
 
    virtual std::int64_t GetValueAsInt() const = 0;
    virtual std::string GetValueAsString() const = 0;
+   /// Used by the structured export to recognize unavailable values; integral counters are always available
+   virtual double GetValueAsDouble() const { return static_cast<double>(GetValueAsInt()); }
    std::string ToString() const;
 };
 
@@ -195,6 +200,9 @@ public:
    std::string GetValueAsString() const override {
       return std::to_string(GetValue());
    }
+
+   double GetValueAsDouble() const override { return GetValue(); }
+   const MetricFunc_t &GetFunc() const { return fFunc; }
 };
 
 // clang-format off
@@ -289,6 +297,8 @@ private:
 
    std::vector<std::unique_ptr<RNTuplePerfCounter>> fCounters;
    std::vector<RNTupleMetrics *> fObservedMetrics;
+   /// The copies of the observed metrics in a snapshot; they are observed, too
+   std::vector<std::unique_ptr<RNTupleMetrics>> fOwnedMetrics;
    std::string fName;
    bool fIsEnabled = false;
 
@@ -318,9 +328,67 @@ public:
 
    void ObserveMetrics(RNTupleMetrics &observee);
 
+   /// Receives the fully qualified name of a counter, e.g. "RNTupleReader.RPageSourceFile.nReadV", and the counter
+   using CounterVisitor_t = std::function<void(const std::string &qualifiedName, const RNTuplePerfCounter &counter)>;
+   /// Calls the visitor for the counters of this object and, recursively, for the counters of the observed metrics
+   void VisitCounters(const CounterVisitor_t &visitor, const std::string &prefix = "") const;
+
    void Print(std::ostream &output, const std::string &prefix = "") const;
+   /// Writes a single JSON object that maps the qualified counter names to their value, unit, and description.
+   /// Unavailable values of calculated counters are written as null.
+   void PrintJSON(std::ostream &output) const;
+   /// Writes the counters in the Prometheus text exposition format.  The qualified counter name, with the namespace
+   /// separator replaced by an underscore, becomes the metric name; the unit is appended as a suffix.
+   void PrintPrometheus(std::ostream &output) const;
+   /// Copies the current values of the atomic counters of this object and of the observed metrics into a new
+   /// metrics object with the same structure and the same qualified counter names.  Calculated counters are
+   /// recreated in the snapshot with the same function, so that they are computed from the copied values.
+   std::unique_ptr<RNTupleMetrics> TakeSnapshot() const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
+   const std::string &GetName() const { return fName; }
+};
+
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleMetricsSampler
+\ingroup NTuple
+\brief Periodically passes a metrics object to a callback from a background thread
+
+Allows for following the counters during a long running read or write, e.g. in order to export them with
+RNTupleMetrics::PrintPrometheus() or to record a time series with RNTupleMetrics::PrintJSON().  The callback is
+called every interval and once more when the sampler is stopped, so that the final state is always captured.
+The callback runs concurrently to the I/O.  Therefore, it does not receive the observed metrics object itself but
+a snapshot with the current values of its atomic counters, see RNTupleMetrics::TakeSnapshot().  The calculated
+values of the snapshot are computed from these copies.  Plain counters are owned by the I/O thread and are not part
+of the snapshot.  No counters must be added to the observed metrics while sampling.
+*/
+// clang-format on
+class RNTupleMetricsSampler {
+public:
+   using Callback_t = std::function<void(const RNTupleMetrics &)>;
+
+private:
+   const RNTupleMetrics &fMetrics;
+   std::chrono::milliseconds fInterval;
+   Callback_t fCallback;
+   std::mutex fLock;
+   std::condition_variable fCvStop;
+   bool fIsStopped = false;
+   std::thread fThread;
+
+   /// The sampling thread routine, calls the callback every fInterval until Stop() is called
+   void ExecSample();
+
+public:
+   RNTupleMetricsSampler(const RNTupleMetrics &metrics, std::chrono::milliseconds interval, Callback_t callback);
+   RNTupleMetricsSampler(const RNTupleMetricsSampler &other) = delete;
+   RNTupleMetricsSampler &operator =(const RNTupleMetricsSampler &other) = delete;
+   ~RNTupleMetricsSampler();
+
+   /// Joins the sampling thread and takes a last sample from the calling thread.  Further calls are no-ops.
+   void Stop();
 };
 
 } // namespace Detail
@@ -18,9 +18,16 @@
 
 #include <Compression.h>
 
+#include <cstddef>
+#include <memory>
+
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RClusterEvictionPolicy;
+}
+
 // clang-format off
 /**
 \class ROOT::Experimental::ENTupleContainerFormat
@@ -41,11 +48,27 @@ enum class ENTupleContainerFormat {
 \brief Common user-tunable settings for storing ntuples
 
 All page sink classes need to support the common options.
+
+If parallel compression is enabled and implicit multi-threading is turned on, the page sink buffers sealed
+(packed) pages and compresses them as tasks on the IMT arena.  The compressed pages are written in order when the
+cluster is committed, or earlier if the buffered pages exceed the given memory limit.
+
+If uncompressed pages are aligned, the page sink places every page that is stored uncompressed at a file offset that
+is a multiple of its element size.  Such pages can be served from a memory mapped file (see
+RNTupleReadOptions::SetUseMmap()) at the cost of a few bytes of padding per page.
+
+By default, the page sink computes the value range of every page and column range and stores it in the footer, so
+that readers can skip data that cannot match a range predicate.  Turning off the statistics saves a scan of every
+page on writing.
 */
 // clang-format on
 class RNTupleWriteOptions {
   int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
   ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
+  bool fUseParallelZip{false};
+  std::size_t fMaxSealedPageBytes{64 * 1024 * 1024};
+  bool fAlignUncompressedPages{false};
+  bool fComputeStatistics{true};
 
 public:
   int GetCompression() const { return fCompression; }
@@ -56,6 +79,18 @@ public:
 
   ENTupleContainerFormat GetContainerFormat() const { return fContainerFormat; }
   void SetContainerFormat(ENTupleContainerFormat val) { fContainerFormat = val; }
+
+  bool GetUseParallelZip() const { return fUseParallelZip; }
+  void SetUseParallelZip(bool val) { fUseParallelZip = val; }
+
+  std::size_t GetMaxSealedPageBytes() const { return fMaxSealedPageBytes; }
+  void SetMaxSealedPageBytes(std::size_t val) { fMaxSealedPageBytes = val; }
+
+  bool GetAlignUncompressedPages() const { return fAlignUncompressedPages; }
+  void SetAlignUncompressedPages(bool val) { fAlignUncompressedPages = val; }
+
+  bool GetComputeStatistics() const { return fComputeStatistics; }
+  void SetComputeStatistics(bool val) { fComputeStatistics = val; }
 };
 
 
@@ -76,12 +111,41 @@ public:
       kDefault = kOn,
    };
 
+   static constexpr unsigned int kDefaultClusterReadAhead = 2;
+
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
+   /// The number of clusters following the currently active cluster that are preloaded by the cluster pool
+   unsigned int fClusterReadAhead = kDefaultClusterReadAhead;
+   /// Upper limit for the compressed size of the clusters in the cluster pool, including the ones being read or
+   /// unzipped.  The active cluster is always loaded.  Zero means no limit.
+   std::size_t fClusterPoolMaxBytes = 0;
+   /// Decides which clusters outside the read-ahead window stay in the cluster pool.  If unset, the cluster pool
+   /// keeps the cluster preceding the active cluster.
+   std::shared_ptr<const Detail::RClusterEvictionPolicy> fClusterEvictionPolicy;
+   /// If the file supports it, uncompressed pages whose on-disk layout matches the in-memory layout are served
+   /// directly from a read-only memory mapping of the file instead of being copied into a page buffer
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+
+   unsigned int GetClusterReadAhead() const { return fClusterReadAhead; }
+   void SetClusterReadAhead(unsigned int val) { fClusterReadAhead = val; }
+
+   std::size_t GetClusterPoolMaxBytes() const { return fClusterPoolMaxBytes; }
+   void SetClusterPoolMaxBytes(std::size_t val) { fClusterPoolMaxBytes = val; }
+
+   std::shared_ptr<const Detail::RClusterEvictionPolicy> GetClusterEvictionPolicy() const {
+      return fClusterEvictionPolicy;
+   }
+   void SetClusterEvictionPolicy(std::shared_ptr<const Detail::RClusterEvictionPolicy> val) {
+      fClusterEvictionPolicy = val;
+   }
+
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
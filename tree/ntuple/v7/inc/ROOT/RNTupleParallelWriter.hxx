@@ -0,0 +1,133 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/REntry.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <memory>
+#include <mutex>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A fill context of a parallel writer, to be used by a single thread
+
+The fill context owns a clone of the parallel writer's model and a buffer page sink.  Filling an entry serializes it
+into the columns of the fill context, pages are sealed (packed and compressed) by the filling thread.  On cluster
+commit, the sealed pages of the cluster are handed over to the shared page sink of the parallel writer.  Only the
+cluster commit is serialized among the fill contexts of a parallel writer.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   static constexpr NTupleSize_t kDefaultClusterSizeEntries = 64000;
+   RNTupleParallelWriter &fWriter;
+   std::unique_ptr<Detail::RPageSinkBuf> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fClusterSizeEntries;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+
+   RNTupleFillContext(RNTupleParallelWriter &writer, std::unique_ptr<RNTupleModel> model,
+                      std::unique_ptr<Detail::RPageSinkBuf> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext&) = delete;
+   RNTupleFillContext& operator=(const RNTupleFillContext&) = delete;
+   ~RNTupleFillContext();
+
+   /// The model of the fill context is a clone of the writer's model. Its default entry belongs to the fill context.
+   RNTupleModel *GetModel() { return fModel.get(); }
+   REntry *GetDefaultEntry() { return fModel->GetDefaultEntry(); }
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// The simplest user interface if the default entry of the fill context is used
+   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   /// The entry must have been created from the model of the fill context
+   void Fill(REntry &entry) {
+      for (auto& value : entry) {
+         value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fNEntries % fClusterSizeEntries) == 0)
+         CommitCluster();
+   }
+   /// Hands over the entries filled so far as a new cluster to the shared page sink of the parallel writer
+   void CommitCluster();
+   /// The number of entries filled so far by this fill context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that is filled concurrently by several threads and written to a single storage container
+
+Every filling thread creates its own RNTupleFillContext.  The fill contexts produce complete clusters independently
+of each other and commit them to the writer's page sink in the order of their CommitCluster() calls.  Hence, the
+order of entries is preserved within a cluster but not among the clusters of different fill contexts.  All the fill
+contexts need to be destructed before the parallel writer.  Models with collection fields created by
+RNTupleModel::MakeCollection() cannot be cloned and are therefore not supported.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+   friend class RNTupleFillContext;
+
+private:
+   /// Serializes the cluster commits of the fill contexts
+   std::mutex fMutex;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink; fill contexts use clones of this model
+   std::unique_ptr<RNTupleModel> fModel;
+   /// The number of entries committed by all the fill contexts together
+   NTupleSize_t fNEntries = 0;
+
+public:
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName,
+                                                          std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter&) = delete;
+   RNTupleParallelWriter& operator=(const RNTupleParallelWriter&) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context.  Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+   /// The number of entries committed so far
+   NTupleSize_t GetNEntries();
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -145,7 +145,8 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields,
+MapV() provides bulk access to all the elements of a page at once.
 */
 // clang-format on
 template <typename T>
@@ -197,6 +198,17 @@ public:
       fField.Read(clusterIndex, &fValue);
       return *fValue.Get<T>();
    }
+
+   /// Bulk access for mappable fields: returns a pointer to the contiguous, in-memory elements starting at
+   /// globalIndex and sets nItems to the number of valid elements behind the pointer.  The elements are valid
+   /// until the next call to the view.  Loops over a range of entries advance by nItems on every call.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, const C*>
+   MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems) { return fField.MapV(globalIndex, nItems); }
+
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, const C*>
+   MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) { return fField.MapV(clusterIndex, nItems); }
 };
 
 
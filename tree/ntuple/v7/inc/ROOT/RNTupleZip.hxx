@@ -96,12 +96,19 @@ public:
    /// Returns the size of the compressed data block. The data is written into the zip buffer.
    /// This works only for small input buffer up to 16MB
    size_t operator() (const void *from, size_t nbytes, int compression) {
+      return Zip(from, nbytes, compression, fZipBuffer->data());
+   }
+
+   /// Stateless version of the above that writes into a caller-provided buffer of at least nbytes.  Since it
+   /// does not touch the internal zip buffer, it can be used concurrently from several threads.
+   static size_t Zip(const void *from, size_t nbytes, int compression, void *to) {
       R__ASSERT(from != nullptr);
+      R__ASSERT(to != nullptr);
       R__ASSERT(nbytes <= kMAXZIPBUF);
 
       auto cxLevel = compression % 100;
       if (cxLevel == 0) {
-         memcpy(fZipBuffer->data(), from, nbytes);
+         memcpy(to, from, nbytes);
          return nbytes;
       }
 
@@ -109,14 +116,14 @@ public:
       int szSource = nbytes;
       char *source = const_cast<char *>(static_cast<const char *>(from));
       int szTarget = nbytes;
-      char *target = reinterpret_cast<char *>(fZipBuffer->data());
+      char *target = reinterpret_cast<char *>(to);
       int szOut = 0;
       R__zipMultipleAlgorithm(cxLevel, &szSource, source, &szTarget, target, &szOut, cxAlgorithm);
       R__ASSERT(szOut >= 0);
       if ((szOut > 0) && (static_cast<unsigned int>(szOut) < nbytes))
          return szOut;
 
-      memcpy(fZipBuffer->data(), from, nbytes);
+      memcpy(to, from, nbytes);
       return nbytes;
    }
 
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 
 namespace ROOT {
 namespace Experimental {
@@ -77,6 +78,59 @@ public:
    static void DeletePage(const RPage &page);
 };
 
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageAllocatorPool
+\ingroup NTuple
+\brief Recycles the memory of released pages and buffers
+
+Requested sizes are rounded up to size classes, four classes per power of two from kMinClassBytes to
+kMaxClassBytes.  Released blocks are kept in per-size-class free lists, first in a cache of the releasing thread
+and, once that is full, in a global depot shared by all threads.  Allocations are served from the thread cache,
+then from the depot, and only then from the heap.  The thread caches are bounded by kMaxThreadCacheBytes and the
+depot by SetMaxRetainedBytes(); blocks beyond the limits and blocks larger than kMaxClassBytes go back to the heap.
+Memory can be released by any thread, which matters for pages that are unzipped by worker threads and released
+by the reading thread.
+*/
+// clang-format on
+class RPageAllocatorPool {
+public:
+   static constexpr std::size_t kMinClassBytes = 64;
+   static constexpr std::size_t kMaxClassBytes = 64 * 1024 * 1024;
+   static constexpr std::size_t kMaxThreadCacheBytes = 8 * 1024 * 1024;
+   static constexpr std::size_t kDefaultMaxRetainedBytes = 128 * 1024 * 1024;
+
+   /// Returns a memory block of at least nbytes; the block must be given back with Release() and the same nbytes
+   static unsigned char *Allocate(std::size_t nbytes);
+   static void Release(void *buffer, std::size_t nbytes);
+
+   /// Gives a block back to the pool when used as the deleter of a std::unique_ptr
+   class RDeleter {
+   private:
+      std::size_t fNBytes = 0;
+
+   public:
+      RDeleter() = default;
+      explicit RDeleter(std::size_t nbytes) : fNBytes(nbytes) {}
+      void operator()(unsigned char *buffer) const { Release(buffer, fNBytes); }
+   };
+   using RBuffer_t = std::unique_ptr<unsigned char[], RDeleter>;
+   /// Like Allocate() but the block goes back to the pool when the returned buffer is destructed
+   static RBuffer_t MakeBuffer(std::size_t nbytes) { return RBuffer_t(Allocate(nbytes), RDeleter(nbytes)); }
+
+   /// Like RPageAllocatorHeap::NewPage() but with memory from the pool
+   static RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements);
+   /// Gives the memory of a page created by NewPage() back to the pool
+   static void DeletePage(const RPage &page);
+
+   /// The upper limit for the size of the blocks in the global depot.  Lowering the limit frees blocks right away.
+   static void SetMaxRetainedBytes(std::size_t nbytes);
+   static std::size_t GetMaxRetainedBytes();
+   /// The size of the blocks held by the global depot and by the cache of the calling thread
+   static std::size_t GetRetainedBytes();
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
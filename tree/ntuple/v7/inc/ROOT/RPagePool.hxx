@@ -20,6 +20,7 @@
 #include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <condition_variable>
 #include <cstddef>
 #include <mutex>
 #include <vector>
@@ -40,12 +41,34 @@ pages is thread-safe. The page pool does not allocate the memory -- allocation a
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
 Multiple page caches can coexist.
 
+Pages that are being unzipped in the background can be announced as pending.  Requests for a pending page block
+until the page is preloaded, which allows to use the first pages of a cluster before the entire cluster is unzipped.
+
 TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
 facilitate pre-filling a cache, e.g. by read-ahead.
 */
 // clang-format on
 class RPagePool {
 private:
+   /// The element range of a page that is announced but not yet preloaded
+   struct RPendingPage {
+      ColumnId_t fColumnId = kInvalidColumnId;
+      NTupleSize_t fRangeFirst = 0;
+      ClusterSize_t::ValueType fNElements = 0;
+      RPage::RClusterInfo fClusterInfo;
+
+      bool Contains(NTupleSize_t globalIndex) const {
+         return (globalIndex >= fRangeFirst) && (globalIndex < fRangeFirst + NTupleSize_t(fNElements));
+      }
+      bool Contains(const RClusterIndex &clusterIndex) const {
+         if (fClusterInfo.GetId() != clusterIndex.GetClusterId())
+            return false;
+         auto clusterRangeFirst = fRangeFirst - fClusterInfo.GetIndexOffset();
+         return (clusterIndex.GetIndex() >= clusterRangeFirst) &&
+                (clusterIndex.GetIndex() < clusterRangeFirst + fNElements);
+      }
+   };
+
    /// TODO(jblomer): should be an efficient index structure that allows
    ///   - random insert
    ///   - random delete
@@ -54,7 +77,16 @@ private:
    std::vector<RPage> fPages;
    std::vector<std::int32_t> fReferences;
    std::vector<RPageDeleter> fDeleters;
+   std::vector<RPendingPage> fPendingPages;
    std::mutex fLock;
+   /// Signals that a pending page has been preloaded
+   std::condition_variable fCvPagePreloaded;
+
+   /// Removes the pending page with the given column and first element, if any; expects fLock to be held
+   void ErasePendingPage(ColumnId_t columnId, NTupleSize_t rangeFirst);
+   /// Searches the page, waiting for it if it is pending; expects fLock to be held by lock
+   template <typename IndexT>
+   RPage WaitForPage(std::unique_lock<std::mutex> &lock, ColumnId_t columnId, const IndexT &index);
 
 public:
    RPagePool() = default;
@@ -65,10 +97,17 @@ public:
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
    void RegisterPage(const RPage &page, const RPageDeleter &deleter);
-   /// Like RegisterPage() but the reference counter is initialized to 0
+   /// Like RegisterPage() but the reference counter is initialized to 0.  Clears the pending page with the same
+   /// column and first element, if any.
    void PreloadPage(const RPage &page, const RPageDeleter &deleter);
+   /// Announces a page that is going to be preloaded, e.g. by an unzip task
+   void AnnouncePage(ColumnId_t columnId, NTupleSize_t rangeFirst, ClusterSize_t::ValueType nElements,
+                     const RPage::RClusterInfo &clusterInfo);
+   /// Withdraws an announced page that is not going to be preloaded, e.g. because its unzip task failed.
+   /// Requests waiting for the page return a null page, so that the caller populates the page itself.
+   void DiscardPendingPage(ColumnId_t columnId, NTupleSize_t rangeFirst);
    /// Tries to find the page corresponding to column and index in the cache. If the page is found, its reference
-   /// counter is increased
+   /// counter is increased.  If the page is pending, blocks until it is preloaded.
    RPage GetPage(ColumnId_t columnId, NTupleSize_t globalIndex);
    RPage GetPage(ColumnId_t columnId, const RClusterIndex &clusterIndex);
    /// Give back a page to the pool and decrease the reference counter. There must not be any pointers anymore into
@@ -0,0 +1,91 @@
+/// \file ROOT/RPageSinkBuf.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSinkBuf
+#define ROOT7_RPageSinkBuf
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkBuf
+\ingroup NTuple
+\brief Page sink that seals the pages of the open cluster and keeps them in memory
+
+Committed pages are packed and compressed right away, i.e. in the thread that fills the columns, and buffered
+until the cluster is complete.  The owner of the buffer sink takes the sealed pages of the cluster with
+ReleaseCluster() and commits them to the actual page sink with CommitSealedPage().  The buffer sink itself does
+not write anything.  It is used by the fill contexts of the parallel writer.
+*/
+// clang-format on
+class RPageSinkBuf : public RPageSink {
+public:
+   /// A sealed page together with the memory that backs it
+   struct RBufferedPage {
+      RPageAllocatorPool::RBuffer_t fBuffer;
+      RSealedPage fSealedPage;
+      /// The value statistics of the page, to be passed on to CommitSealedPage()
+      RClusterDescriptor::RStatistics fStatistics;
+   };
+   /// The sealed pages of a column in the order of their commit
+   using ColumnBuffer_t = std::vector<RBufferedPage>;
+
+private:
+   RNTupleMetrics fMetrics;
+   /// The buffered pages of the open cluster, indexed by column id
+   std::vector<ColumnBuffer_t> fBufferedColumns;
+   /// The sum of the sealed page sizes of the open cluster
+   std::size_t fBufferedBytes = 0;
+
+protected:
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   void CommitDatasetImpl() final {}
+
+public:
+   RPageSinkBuf(std::string_view ntupleName, const RNTupleWriteOptions &options);
+   RPageSinkBuf(const RPageSinkBuf&) = delete;
+   RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
+   RPageSinkBuf(RPageSinkBuf&&) = default;
+   RPageSinkBuf& operator=(RPageSinkBuf&&) = default;
+   virtual ~RPageSinkBuf();
+
+   /// Hands over the buffered pages of the open cluster, indexed by column id, and starts a new cluster
+   std::vector<ColumnBuffer_t> ReleaseCluster();
+   std::size_t GetBufferedBytes() const { return fBufferedBytes; }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorage
 #define ROOT7_RPageStorage
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -27,7 +28,10 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -37,8 +41,8 @@ class RNTupleModel;
 
 namespace Detail {
 
-class RCluster;
 class RColumn;
+class RColumnElementBase;
 class RPagePool;
 class RFieldBase;
 class RNTupleMetrics;
@@ -71,6 +75,15 @@ public:
       virtual void Wait() = 0;
    };
 
+   /// A page that is packed and compressed, i.e. in the form in which it is written to storage.  The sealed page
+   /// does not own its buffer.
+   struct RSealedPage {
+      const void *fBuffer = nullptr;
+      /// The number of bytes on storage
+      std::uint32_t fSize = 0;
+      std::uint32_t fNElements = 0;
+   };
+
 protected:
    std::string fNTupleName;
    RTaskScheduler *fTaskScheduler = nullptr;
@@ -139,10 +152,20 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// The last offset of the previously committed page in the currently open cluster; only used for offset columns
+   /// in order to compute the collection sizes of the next page.  Indexed by column id.
+   std::vector<ClusterSize_t::ValueType> fOpenLastOffsets;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
+   /// The value statistics of an in-memory page that is committed next for the given column
+   RClusterDescriptor::RStatistics ComputeStatistics(ColumnHandle_t columnHandle, const RPage &page);
+   /// Registers a committed page in the open cluster and adds its statistics to the column range
+   void AddPageInfo(DescriptorId_t columnId, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo);
+
    virtual void CreateImpl(const RNTupleModel &model) = 0;
    virtual RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
+   virtual RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId,
+                                                             const RSealedPage &sealedPage) = 0;
    virtual RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) = 0;
    virtual void CommitDatasetImpl() = 0;
 
@@ -159,6 +182,7 @@ public:
    static std::unique_ptr<RPageSink> Create(std::string_view ntupleName, std::string_view location,
                                             const RNTupleWriteOptions &options = RNTupleWriteOptions());
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
+   const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -169,10 +193,20 @@ public:
    void Create(RNTupleModel &model);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
+   /// Write a page that has been sealed before, e.g. by another page sink, to the storage.  The column must have
+   /// been added before.  The statistics of the values in the page are taken as given.
+   void CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage,
+                         const RClusterDescriptor::RStatistics &statistics = RClusterDescriptor::RStatistics());
+   /// Packs and compresses the page into buffer, which needs to provide at least page.GetSize() bytes.  Can be
+   /// called concurrently from several threads.
+   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting,
+                               void *buffer);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
    void CommitDataset() { CommitDatasetImpl(); }
+   /// The descriptor of the data written so far; clusters appear once they are committed
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    /// Get a new, empty page for the given column that can be filled with up to nElements.  If nElements is zero,
    /// the page sink picks an appropriate size.
@@ -192,18 +226,33 @@ mapped into memory. The page source also gives access to the ntuple's meta-data.
 class RPageSource : public RPageStorage {
 public:
    /// Derived from the model (fields) that are actually being requested at a given point in time
-   using ColumnSet_t = std::unordered_set<DescriptorId_t>;
+   using ColumnSet_t = RCluster::ColumnSet_t;
 
 protected:
    RNTupleReadOptions fOptions;
    RNTupleDescriptor fDescriptor;
-   /// The active columns are implicitly defined by the model fields or views
+   /// The active columns are implicitly defined by the model fields or views.  Only the active columns are
+   /// requested from LoadCluster(), so that reading a few fields of a wide ntuple only loads the pages of these fields.
    ColumnSet_t fActiveColumns;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
    // Only called if a task scheduler is set. No-op be default.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
+   /// Returns an element that unpacks pages of the given active column into the in-memory type of the column.
+   /// Thread-safe, used by the unzip tasks.
+   std::shared_ptr<RColumnElementBase> GetActiveElement(DescriptorId_t columnId);
+
+private:
+   /// Several fields can be connected to the same column, e.g. a view and a model field on the same field.
+   /// A column remains active until the last of them is dropped.
+   std::unordered_map<DescriptorId_t, std::size_t> fActiveColumnRefs;
+   /// Elements of the in-memory types of the active columns, created from the on-disk column models
+   std::unordered_map<DescriptorId_t, std::shared_ptr<RColumnElementBase>> fActiveElements;
+   /// Protects fActiveElements, which is read by the unzip thread
+   std::mutex fLockActiveElements;
+   /// Set if unzip tasks have been scheduled that have not yet been waited for
+   bool fHasUnzipTasks = false;
 
 public:
    RPageSource(std::string_view ntupleName, const RNTupleReadOptions &fOptions);
@@ -233,6 +282,11 @@ public:
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
    /// Another version of PopulatePage that allows to specify cluster-relative indexes
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) = 0;
+   /// Reads the page that contains the given element as it is stored, i.e. without decompressing and unpacking it.
+   /// If sealedPage.fBuffer is nullptr, only the page size and the number of elements are set.  Otherwise, the
+   /// page is copied into the buffer, which must provide at least sealedPage.fSize bytes.
+   virtual void LoadSealedPage(DescriptorId_t columnId, const RClusterIndex &clusterIndex,
+                               RSealedPage &sealedPage) = 0;
 
    /// Populates all the pages of the given cluster id and columns; it is possible that some columns do not
    /// contain any pages.  The pages source may load more columns than the minimal necessary set from `columns`.
@@ -242,13 +296,22 @@ public:
    /// LoadCluster() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+   /// Batch version of LoadCluster() that is used by the cluster pool to request the current cluster together
+   /// with the clusters in its look-ahead window.  The returned clusters are in the order of the given keys.
+   /// The default implementation calls LoadCluster() for every key.  Page sources that can issue the reads of
+   /// several clusters as a single request should override it.
+   virtual std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RCluster::RKey> &clusterKeys);
 
    /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
    /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
    /// unzip thread. It is an optional optimization, the method can safely do nothing. In particular, the
    /// actual implementation will only run if a task scheduler is set. In practice, a task scheduler is set
-   /// if implicit multi-threading is turned on.
+   /// if implicit multi-threading is turned on.  The method only schedules one task per page and returns
+   /// immediately; the pages become available one by one.  The tasks of several clusters can run concurrently.
    void UnzipCluster(RCluster *cluster);
+   /// Blocks until the tasks scheduled by previous UnzipCluster() calls are done.  Called by the cluster pool's
+   /// unzip thread when it runs out of work.
+   void WaitForUnzip();
 };
 
 } // namespace Detail
@@ -16,10 +16,13 @@
 #ifndef ROOT7_RPageStorageFile
 #define ROOT7_RPageStorageFile
 
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <array>
@@ -27,20 +30,17 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 class TFile;
 
 namespace ROOT {
 
-namespace Internal {
-class RRawFile;
-}
-
 namespace Experimental {
 namespace Detail {
 
 class RClusterPool;
-class RPageAllocatorHeap;
+class RPageAllocatorPool;
 class RPagePool;
 
 
@@ -51,6 +51,9 @@ class RPagePool;
 \brief Storage provider that write ntuple pages into a file
 
 The written file can be either in ROOT format or in RNTuple bare format.
+Committed pages are only sealed, i.e. packed into a private buffer.  The sealed pages are compressed, in parallel if
+a task scheduler is set, and written in order on cluster commit or when the memory limit for sealed pages is hit.
+The pages are written by a single vector write, which avoids many small writes on parallel file systems.
 */
 // clang-format on
 class RPageSinkFile : public RPageSink {
@@ -58,8 +61,22 @@ public:
    static constexpr std::size_t kDefaultElementsPerPage = 10000;
 
 private:
+   /// A packed page that waits for parallel compression and for being written out.  Pages committed through
+   /// CommitSealedPage() are already compressed: they only have a zip buffer.
+   struct RPendingPage {
+      /// Together with fPageIndex, points to the page info in fOpenPageRanges whose locator is set on write
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      std::size_t fPageIndex = 0;
+      RPageAllocatorPool::RBuffer_t fPackedBuffer;
+      std::size_t fPackedBytes = 0;
+      RPageAllocatorPool::RBuffer_t fZipBuffer;
+      std::size_t fZippedBytes = 0;
+      /// The file offset alignment of the page if it is stored uncompressed
+      std::size_t fAlignment = 1;
+   };
+
    RNTupleMetrics fMetrics;
-   std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
+   std::unique_ptr<RPageAllocatorPool> fPageAllocator;
 
    std::unique_ptr<Internal::RNTupleFileWriter> fWriter;
    /// Byte offset of the first page of the current cluster
@@ -68,10 +85,20 @@ private:
    std::uint64_t fClusterMaxOffset = 0;
    /// Helper for zipping keys and header / footer; comprises a 16MB zip buffer
    RNTupleCompressor fCompressor;
+   /// Pages of the currently open cluster that are packed but not yet compressed and written
+   std::vector<RPendingPage> fSealedPages;
+   /// The memory held by the buffered pages, i.e. the packed size of the pages from CommitPageImpl() and the
+   /// compressed size of the pages from CommitSealedPageImpl(), kept below RNTupleWriteOptions::GetMaxSealedPageBytes()
+   std::size_t fSealedPageBytes = 0;
+
+   /// Compresses the sealed pages, using the task scheduler if available, writes them in order by a single
+   /// vector write, and sets their page locators
+   void CommitSealedPages();
 
 protected:
    void CreateImpl(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
    RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
    void CommitDatasetImpl() final;
 
@@ -98,6 +125,8 @@ public:
 \class ROOT::Experimental::Detail::RPageAllocatorFile
 \ingroup NTuple
 \brief Manages pages read from a the file
+
+The page buffers are expected to be taken from the RPageAllocatorPool with the size of the page.
 */
 // clang-format on
 class RPageAllocatorFile {
@@ -130,6 +159,7 @@ private:
       RNTupleAtomicCounter &fNClusterLoaded;
       RNTupleAtomicCounter &fNPageLoaded;
       RNTupleAtomicCounter &fNPagePopulated;
+      RNTupleAtomicCounter &fNPageMapped;
       RNTupleAtomicCounter &fTimeWallRead;
       RNTupleAtomicCounter &fTimeWallUnzip;
       RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
@@ -158,10 +188,23 @@ private:
    Internal::RMiniFileReader fReader;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Read-only mapping of the entire file if RNTupleReadOptions::GetUseMmap() is set and fFile supports it
+   unsigned char *fMmapRegion = nullptr;
+   std::size_t fMmapSize = 0;
 
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
+   /// Returns the address of the page in the memory mapped file if the page can be used in place, i.e. if it is
+   /// stored uncompressed, its elements are mappable and the address is suitably aligned; nullptr otherwise.
+   void *GetMappedPage(const RClusterDescriptor::RPageRange::RPageInfo &pageInfo,
+                       const RColumnElementBase &element) const;
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
+   /// read requests for a given cluster and columns.  The read requests are appended to
+   /// the provided vector.  This way, requests can be collected for multiple clusters before
+   /// sending them to RRawFile::ReadV().
+   std::unique_ptr<RCluster> PrepareSingleCluster(const RCluster::RKey &clusterKey,
+                                                  std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
@@ -181,9 +224,11 @@ public:
 
    RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
    RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
+   void LoadSealedPage(DescriptorId_t columnId, const RClusterIndex &clusterIndex, RSealedPage &sealedPage) final;
    void ReleasePage(RPage &page) final;
 
    std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(const std::vector<RCluster::RKey> &clusterKeys) final;
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
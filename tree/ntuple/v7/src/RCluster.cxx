@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RPageAllocator.hxx>
 
 #include <TError.h>
 
@@ -29,6 +30,11 @@ ROOT::Experimental::Detail::ROnDiskPageMap::~ROnDiskPageMap() = default;
 
 ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap() = default;
 
+ROOT::Experimental::Detail::ROnDiskPageMapPool::~ROnDiskPageMapPool()
+{
+   RPageAllocatorPool::Release(fMemory, fSize);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -47,8 +47,43 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterId < other.fClusterId;
 }
 
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::Detail::RClusterLookBackPolicy::GetRetainedClusters(DescriptorId_t activeClusterId,
+                                                                       const RNTupleDescriptor &desc) const
+{
+   std::vector<DescriptorId_t> result;
+   auto prev = activeClusterId;
+   for (unsigned int i = 0; i < fNClusters; ++i) {
+      prev = desc.FindPrevClusterId(prev);
+      if (prev == kInvalidDescriptorId)
+         break;
+      result.emplace_back(prev);
+   }
+   return result;
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RClusterPool::RCounters>
+ROOT::Experimental::Detail::RClusterPool::MakeCounters(RNTupleMetrics &metrics)
+{
+   return std::unique_ptr<RCounters>(new RCounters{
+      *metrics.MakeCounter<RNTupleAtomicCounter*>("nClusterRequested", "", "number of requested clusters"),
+      *metrics.MakeCounter<RNTupleAtomicCounter*>("nClusterHit", "",
+         "number of requested clusters found complete in the pool"),
+      *metrics.MakeCounter<RNTupleAtomicCounter*>("nClusterScheduled", "",
+         "number of cluster load requests passed to the I/O thread"),
+      *metrics.MakeCounter<RNTupleAtomicCounter*>("nClusterEvicted", "", "number of clusters evicted from the pool"),
+      *metrics.MakeCounter<RNTupleAtomicCounter*>("nClusterDiscarded", "",
+         "number of loaded clusters discarded because they were not needed anymore"),
+      *metrics.MakeCounter<RNTupleAtomicCounter*>("timeWallWait", "ns",
+         "wall clock time spent waiting for in-flight clusters")
+   });
+}
+
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int size)
-   : fPageSource(pageSource)
+   : fMetrics("RClusterPool")
+   , fCounters(MakeCounters(fMetrics))
+   , fPageSource(pageSource)
    , fPool(size)
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
@@ -61,6 +96,26 @@ ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource,
       fWindowPre++;
       fWindowPost--;
    }
+   fEvictionPolicy = std::make_shared<RClusterLookBackPolicy>(fWindowPre);
+}
+
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options)
+   : fMetrics("RClusterPool")
+   , fCounters(MakeCounters(fMetrics))
+   , fPageSource(pageSource)
+   , fWindowPre(0)
+   , fWindowPost(options.GetClusterReadAhead() + 1)
+   , fMaxBytes(options.GetClusterPoolMaxBytes())
+   , fEvictionPolicy(options.GetClusterEvictionPolicy())
+   , fPool(fWindowPost)
+   , fThreadIo(&RClusterPool::ExecReadClusters, this)
+   , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
+{
+   if (!fEvictionPolicy) {
+      fWindowPre = 1;
+      fEvictionPolicy = std::make_shared<RClusterLookBackPolicy>(fWindowPre);
+   }
+   fPool.resize(fWindowPre + fWindowPost);
 }
 
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
@@ -96,14 +151,22 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
       }
 
       for (auto &item : unzipItems) {
-         if (!item.fCluster)
+         if (!item.fCluster) {
+            fPageSource.WaitForUnzip();
             return;
+         }
 
+         // Only schedules the unzip tasks; the pages are announced to the page pool, so that the main thread
+         // can use them as soon as they are unzipped
          fPageSource.UnzipCluster(item.fCluster.get());
 
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
          item.fPromise.set_value(std::move(item.fCluster));
       }
+
+      // Unzip tasks of all the clusters in the batch run concurrently.  While waiting, the unzip thread takes part
+      // in executing the tasks.
+      fPageSource.WaitForUnzip();
    } // while (true)
 }
 
@@ -120,12 +183,25 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
          }
       }
 
-      for (auto &item : readItems) {
-         if (item.fClusterId == kInvalidDescriptorId)
-            return;
+      // The page source loads all the requested clusters in one go, which allows it to batch the reads, e.g. of
+      // the current cluster and the clusters of the look-ahead window
+      std::vector<RCluster::RKey> clusterKeys;
+      bool isTerminated = false;
+      for (const auto &item : readItems) {
+         if (item.fClusterId == kInvalidDescriptorId) {
+            isTerminated = true;
+            break;
+         }
+         clusterKeys.emplace_back(RCluster::RKey{item.fClusterId, item.fColumns});
+      }
+      std::vector<std::unique_ptr<RCluster>> clusters;
+      if (!clusterKeys.empty())
+         clusters = fPageSource.LoadClusters(clusterKeys);
+      R__ASSERT(clusters.size() == clusterKeys.size());
 
-         // TODO(jblomer): the page source needs to be capable of loading multiple clusters in one go
-         auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         auto &item = readItems[i];
+         auto &cluster = clusters[i];
 
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -140,6 +216,7 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             }
          }
          if (discard) {
+            fCounters->fNClusterDiscarded.Inc();
             cluster.reset();
             item.fPromise.set_value(std::move(cluster));
          } else {
@@ -149,6 +226,9 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             fCvHasUnzipWork.notify_one();
          }
       }
+
+      if (isTerminated)
+         return;
    } // while (true)
 }
 
@@ -162,7 +242,7 @@ ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) c
    return nullptr;
 }
 
-size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot() const
+size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot()
 {
    auto N = fPool.size();
    for (unsigned i = 0; i < N; ++i) {
@@ -170,7 +250,7 @@ size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot() const
          return i;
    }
 
-   R__ASSERT(false);
+   fPool.emplace_back(nullptr);
    return N;
 }
 
@@ -214,6 +294,20 @@ public:
    decltype(fMap)::iterator end() { return fMap.end(); }
 };
 
+/// The compressed size of the pages of the given columns in the given cluster
+std::size_t GetClusterBytes(const ROOT::Experimental::RNTupleDescriptor &desc,
+                            ROOT::Experimental::DescriptorId_t clusterId,
+                            const ROOT::Experimental::Detail::RPageSource::ColumnSet_t &columns)
+{
+   const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+   std::size_t nBytes = 0;
+   for (auto columnId : columns) {
+      for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos)
+         nBytes += pageInfo.fLocator.fBytesOnStorage;
+   }
+   return nBytes;
+}
+
 } // anonymous namespace
 
 ROOT::Experimental::Detail::RCluster *
@@ -221,31 +315,44 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
    DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns)
 {
    const auto &desc = fPageSource.GetDescriptor();
+   fCounters->fNClusterRequested.Inc();
 
-   // Determine previous cluster ids that we keep if they happen to be in the pool
-   std::set<DescriptorId_t> keep;
-   auto prev = clusterId;
-   for (unsigned int i = 0; i < fWindowPre; ++i) {
-      prev = desc.FindPrevClusterId(prev);
-      if (prev == kInvalidDescriptorId)
-         break;
-      keep.insert(prev);
-   }
-
-   // Determine following cluster ids and the column ids that we want to make available
+   // Determine following cluster ids and the column ids that we want to make available.  With a memory limit,
+   // the look-ahead window ends before the first cluster that does not fit anymore.  The active cluster is always
+   // loaded.  The limit includes the in-flight clusters, i.e. the work of both the I/O and the unzip thread.
    RProvides provide;
    provide.Insert(clusterId, columns);
+   std::size_t nBytes = (fMaxBytes > 0) ? GetClusterBytes(desc, clusterId, columns) : 0;
    auto next = clusterId;
-   // TODO(jblomer): instead of a fixed-sized window, eventually we should determine the window size based on
-   // a user-defined memory limit.  The size of the preloaded data can be determined at the beginning of
-   // GetCluster from the descriptor and the current contents of fPool.
    for (unsigned int i = 1; i < fWindowPost; ++i) {
       next = desc.FindNextClusterId(next);
       if (next == kInvalidDescriptorId)
          break;
+      if (fMaxBytes > 0) {
+         auto nBytesNext = GetClusterBytes(desc, next, columns);
+         if (nBytes + nBytesNext > fMaxBytes)
+            break;
+         nBytes += nBytesNext;
+      }
       provide.Insert(next, columns);
    }
 
+   // Determine the cluster ids that we keep if they happen to be in the pool, as long as they fit in the limit
+   std::set<DescriptorId_t> keep;
+   for (auto retainedId : fEvictionPolicy->GetRetainedClusters(clusterId, desc)) {
+      if (provide.Contains(retainedId))
+         continue;
+      if (fMaxBytes > 0) {
+         auto retainedCluster = FindInPool(retainedId);
+         auto nBytesRetained = retainedCluster ? GetClusterBytes(desc, retainedId, retainedCluster->GetAvailColumns())
+                                               : GetClusterBytes(desc, retainedId, columns);
+         if (nBytes + nBytesRetained > fMaxBytes)
+            break;
+         nBytes += nBytesRetained;
+      }
+      keep.insert(retainedId);
+   }
+
    // Clear the cache from clusters not the in the look-ahead or the look-back window
    for (auto &cptr : fPool) {
       if (!cptr)
@@ -254,6 +361,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          continue;
       if (keep.count(cptr->GetId()) > 0)
          continue;
+      fCounters->fNClusterEvicted.Inc();
       cptr.reset();
    }
 
@@ -280,6 +388,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          auto cptr = itr->fFuture.get();
          // If cptr is nullptr, the cluster expired previously and was released by the I/O thread
          if (!cptr || itr->fIsExpired) {
+            if (cptr)
+               fCounters->fNClusterDiscarded.Inc();
             cptr.reset();
             itr = fInFlightClusters.erase(itr);
             continue;
@@ -321,6 +431,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          fInFlightClusters.emplace_back(std::move(inFlightCluster));
 
          fReadQueue.emplace(std::move(readItem));
+         fCounters->fNClusterScheduled.Inc();
       }
       if (fReadQueue.size() > 0)
          fCvHasReadWork.notify_one();
@@ -334,6 +445,7 @@ ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::WaitFor(
    DescriptorId_t clusterId, const RPageSource::ColumnSet_t &columns)
 {
+   bool isFirstAttempt = true;
    while (true) {
       // Fast exit: the cluster happens to be already present in the cache pool
       auto result = FindInPool(clusterId);
@@ -346,9 +458,13 @@ ROOT::Experimental::Detail::RClusterPool::WaitFor(
             hasMissingColumn = true;
             break;
          }
-         if (!hasMissingColumn)
+         if (!hasMissingColumn) {
+            if (isFirstAttempt)
+               fCounters->fNClusterHit.Inc();
             return result;
+         }
       }
+      isFirstAttempt = false;
 
       // Otherwise the missing data must have been triggered for loading by now, so block and wait
       decltype(fInFlightClusters)::iterator itr;
@@ -366,7 +482,12 @@ ROOT::Experimental::Detail::RClusterPool::WaitFor(
          // is released.  We need to release the lock before potentially blocking on the cluster future.
       }
 
+      auto tStartWait = std::chrono::steady_clock::now();
       auto cptr = itr->fFuture.get();
+      if (fCounters->fTimeWallWait.IsEnabled()) {
+         fCounters->fTimeWallWait.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - tStartWait).count());
+      }
       if (result) {
          result->Adopt(std::move(*cptr));
       } else {
@@ -15,11 +15,15 @@
 
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RColumnModel.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
 
 #include <TError.h>
 
 #include <iostream>
+#include <string>
+#include <utility>
 
 ROOT::Experimental::Detail::RColumn::RColumn(const RColumnModel& model, std::uint32_t index)
    : fModel(model), fIndex(index), fPageSink(nullptr), fPageSource(nullptr), fHeadPage(), fNElements(0),
@@ -53,12 +57,30 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
       fHandleSource = fPageSource->AddColumn(fieldId, *this);
       fNElements = fPageSource->GetNElements(fHandleSource);
       fColumnIdSource = fPageSource->GetColumnId(fHandleSource);
+      AdoptOnDiskModel();
       break;
    default:
       R__ASSERT(false);
    }
 }
 
+void ROOT::Experimental::Detail::RColumn::AdoptOnDiskModel()
+{
+   // The on-disk column may use a different encoding (e.g., split) of the same in-memory type.  In that case,
+   // the element used for unpacking pages needs to follow the on-disk column type.
+   const auto &onDiskModel = fPageSource->GetDescriptor().GetColumnDescriptor(fHandleSource.fId).GetModel();
+   if (onDiskModel == fModel)
+      return;
+
+   auto onDiskElement = fGenerateElement(onDiskModel);
+   if (onDiskElement->GetSize() != fElement->GetSize()) {
+      throw RException(R__FAIL("on-disk column type incompatible with the in-memory type of column "
+                               + std::to_string(fHandleSource.fId)));
+   }
+   fModel = onDiskModel;
+   fElement = std::move(onDiskElement);
+}
+
 void ROOT::Experimental::Detail::RColumn::Flush()
 {
    if (fHeadPage.GetSize() == 0) return;
@@ -19,10 +19,231 @@
 
 #include <algorithm>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <utility>
 
+namespace {
+
+/// Transposes count elements of N bytes each into N byte planes of count bytes each.  The inner loops run over
+/// contiguous memory on at least one side and are written such that the compiler can vectorize them.
+/// The byte planes are written in memory order, i.e. starting with the least significant byte on little-endian
+/// platforms.
+template <std::size_t N>
+void CastSplitPack(void *destination, const void *source, std::size_t count)
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(destination);
+   auto unsplitArray = reinterpret_cast<const unsigned char *>(source);
+   for (std::size_t b = 0; b < N; ++b) {
+      unsigned char *plane = splitArray + b * count;
+      for (std::size_t i = 0; i < count; ++i) {
+         plane[i] = unsplitArray[i * N + b];
+      }
+   }
+}
+
+/// The inverse of CastSplitPack()
+template <std::size_t N>
+void CastSplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   auto unsplitArray = reinterpret_cast<unsigned char *>(destination);
+   auto splitArray = reinterpret_cast<const unsigned char *>(source);
+   for (std::size_t b = 0; b < N; ++b) {
+      const unsigned char *plane = splitArray + b * count;
+      for (std::size_t i = 0; i < count; ++i) {
+         unsplitArray[i * N + b] = plane[i];
+      }
+   }
+}
+
+/// Like CastSplitPack() but applies the encoding function to every element before scattering its bytes
+/// into the byte planes.  The source buffer is left untouched.
+template <typename T, typename EncodeFuncT>
+void CastEncodeSplitPack(void *destination, const void *source, std::size_t count, EncodeFuncT encode)
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(destination);
+   auto unsplitArray = reinterpret_cast<const T *>(source);
+   for (std::size_t i = 0; i < count; ++i) {
+      T value = encode(unsplitArray, i);
+      unsigned char bytes[sizeof(T)];
+      memcpy(bytes, &value, sizeof(T));
+      for (std::size_t b = 0; b < sizeof(T); ++b)
+         splitArray[b * count + i] = bytes[b];
+   }
+}
+
+/// Reverts the per-page delta encoding of unsigned integers in place by a prefix sum
+template <typename T>
+void DeltaDecode(T *values, std::size_t count)
+{
+   for (std::size_t i = 1; i < count; ++i)
+      values[i] += values[i - 1];
+}
+
+template <typename UIntT, typename IntT>
+UIntT ZigzagEncode(IntT value)
+{
+   return (static_cast<UIntT>(value) << 1) ^ static_cast<UIntT>(value >> (8 * sizeof(IntT) - 1));
+}
+
+/// Reverts the zigzag encoding in place; the loop has no dependencies between iterations and can be vectorized
+template <typename UIntT>
+void ZigzagDecode(UIntT *values, std::size_t count)
+{
+   for (std::size_t i = 0; i < count; ++i)
+      values[i] = (values[i] >> 1) ^ (~(values[i] & 1) + 1);
+}
+
+/// Converts a float to IEEE 754 half precision, rounding to nearest even.  Numbers too large for half precision
+/// become infinity, NaN stays NaN.
+std::uint16_t FloatToHalf(float value)
+{
+   std::uint32_t bits;
+   memcpy(&bits, &value, sizeof(bits));
+   const std::uint16_t sign = (bits >> 16) & 0x8000;
+   bits &= 0x7fffffff;
+
+   if (bits >= 0x7f800000) // infinity or NaN
+      return sign | 0x7c00 | ((bits > 0x7f800000) ? 0x0200 : 0);
+   if (bits >= 0x477ff000) // rounds to infinity
+      return sign | 0x7c00;
+   if (bits < 0x38800000) { // subnormal half precision number or zero
+      float absValue;
+      memcpy(&absValue, &bits, sizeof(absValue));
+      // The unit of the subnormal half precision numbers is 2^-24
+      return sign | static_cast<std::uint16_t>(std::nearbyint(absValue * 16777216.f));
+   }
+   // Rebias the exponent from 127 to 15 and round the mantissa from 23 bits to 10 bits
+   bits -= 0x38000000;
+   bits += 0x0fff + ((bits >> 13) & 1);
+   return sign | static_cast<std::uint16_t>(bits >> 13);
+}
+
+float HalfToFloat(std::uint16_t half)
+{
+   const std::uint32_t sign = std::uint32_t(half & 0x8000) << 16;
+   const std::uint32_t exponent = (half >> 10) & 0x1f;
+   const std::uint32_t mantissa = half & 0x03ff;
+
+   std::uint32_t bits;
+   if (exponent == 0) {
+      float absValue = mantissa * (1.f / 16777216.f);
+      memcpy(&bits, &absValue, sizeof(bits));
+      bits |= sign;
+   } else if (exponent == 0x1f) {
+      bits = sign | 0x7f800000 | (mantissa << 13);
+   } else {
+      bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+   }
+   float result;
+   memcpy(&result, &bits, sizeof(result));
+   return result;
+}
+
+/// The 8bit floating point numbers are the upper byte of half precision numbers, rounded to nearest even
+std::uint8_t HalfToReal8(std::uint16_t half)
+{
+   if ((half & 0x7c00) == 0x7c00) // infinity or NaN; keep the NaN payload in the upper byte
+      return (half >> 8) | ((half & 0x03ff) ? 0x02 : 0);
+   return (half + 0x7f + ((half >> 8) & 1)) >> 8;
+}
+
+template <typename UIntT>
+UIntT EncodeReducedFloat(float value);
+template <>
+std::uint16_t EncodeReducedFloat<std::uint16_t>(float value)
+{
+   return FloatToHalf(value);
+}
+template <>
+std::uint8_t EncodeReducedFloat<std::uint8_t>(float value)
+{
+   return HalfToReal8(FloatToHalf(value));
+}
+
+template <typename UIntT>
+float DecodeReducedFloat(UIntT value);
+template <>
+float DecodeReducedFloat<std::uint16_t>(std::uint16_t value)
+{
+   return HalfToFloat(value);
+}
+template <>
+float DecodeReducedFloat<std::uint8_t>(std::uint8_t value)
+{
+   return HalfToFloat(std::uint16_t(value) << 8);
+}
+
+/// Maps [min, max] linearly to the full range of UIntT.  Values outside the range are clamped, NaN maps to min.
+template <typename UIntT>
+UIntT Quantize(double value, double min, double max)
+{
+   const double kMaxInt = std::numeric_limits<UIntT>::max();
+   if (!(value > min))
+      return 0;
+   if (value >= max)
+      return std::numeric_limits<UIntT>::max();
+   return static_cast<UIntT>((value - min) / (max - min) * kMaxInt + 0.5);
+}
+
+template <typename RealT, typename UIntT>
+void PackReducedPrecision(void *destination, const void *source, std::size_t count,
+                          const ROOT::Experimental::Detail::RColumnElementReducedPrecision &element)
+{
+   auto dst = reinterpret_cast<UIntT *>(destination);
+   auto src = reinterpret_cast<const RealT *>(source);
+   if (element.HasValueRange()) {
+      const double min = element.GetValueMin();
+      const double max = element.GetValueMax();
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] = Quantize<UIntT>(src[i], min, max);
+   } else {
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] = EncodeReducedFloat<UIntT>(static_cast<float>(src[i]));
+   }
+}
+
+template <typename RealT, typename UIntT>
+void UnpackReducedPrecision(void *destination, const void *source, std::size_t count,
+                            const ROOT::Experimental::Detail::RColumnElementReducedPrecision &element)
+{
+   auto dst = reinterpret_cast<RealT *>(destination);
+   auto src = reinterpret_cast<const UIntT *>(source);
+   if (element.HasValueRange()) {
+      const double min = element.GetValueMin();
+      const double scale = (element.GetValueMax() - min) / std::numeric_limits<UIntT>::max();
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] = static_cast<RealT>(min + src[i] * scale);
+   } else {
+      for (std::size_t i = 0; i < count; ++i)
+         dst[i] = DecodeReducedFloat<UIntT>(src[i]);
+   }
+}
+
+template <typename RealT>
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+GenerateReducedPrecision(const ROOT::Experimental::RColumnModel &model)
+{
+   using ROOT::Experimental::EColumnType;
+   using ROOT::Experimental::Detail::RColumnElement;
+   using ROOT::Experimental::Detail::RColumnElementReducedPrecision;
+
+   std::unique_ptr<RColumnElementReducedPrecision> element;
+   switch (model.GetType()) {
+   case EColumnType::kReal16: element = std::make_unique<RColumnElement<RealT, EColumnType::kReal16>>(nullptr); break;
+   case EColumnType::kReal8: element = std::make_unique<RColumnElement<RealT, EColumnType::kReal8>>(nullptr); break;
+   default: return ROOT::Experimental::Detail::RColumnElementBase::Generate(model.GetType());
+   }
+   if (model.HasValueRange())
+      element->SetValueRange(model.GetValueMin(), model.GetValueMax());
+   return element;
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -42,6 +263,24 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kReal16:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal16>>(nullptr);
+   case EColumnType::kReal8:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal8>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kDeltaIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kDeltaIndex>>(nullptr);
+   case EColumnType::kZigzagInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kZigzagInt64>>(nullptr);
+   case EColumnType::kZigzagInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kZigzagInt32>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -49,6 +288,22 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    return nullptr;
 }
 
+template <>
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RColumnElementBase::Generate<float>(const RColumnModel &model)
+{
+   return GenerateReducedPrecision<float>(model);
+}
+
+template <>
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RColumnElementBase::Generate<double>(const RColumnModel &model)
+{
+   if (model.GetType() == EColumnType::kReal32)
+      return std::make_unique<RColumnElement<double, EColumnType::kReal32>>(nullptr);
+   return GenerateReducedPrecision<double>(model);
+}
+
 std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(EColumnType type) {
    switch (type) {
    case EColumnType::kReal32:
@@ -67,6 +322,24 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kReal16:
+      return 16;
+   case EColumnType::kReal8:
+      return 8;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kDeltaIndex:
+      return 32;
+   case EColumnType::kZigzagInt64:
+      return 64;
+   case EColumnType::kZigzagInt32:
+      return 32;
    default:
       R__ASSERT(false);
    }
@@ -107,3 +380,165 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
       }
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                               ROOT::Experimental::EColumnType::kDeltaIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   using Value_t = ClusterSize_t::ValueType;
+   CastEncodeSplitPack<Value_t>(dst, src, count, [](const Value_t *values, std::size_t i) {
+      return (i == 0) ? values[0] : static_cast<Value_t>(values[i] - values[i - 1]);
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                               ROOT::Experimental::EColumnType::kDeltaIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+   DeltaDecode(reinterpret_cast<ClusterSize_t::ValueType *>(dst), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kZigzagInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastEncodeSplitPack<std::int64_t>(dst, src, count, [](const std::int64_t *values, std::size_t i) {
+      return static_cast<std::int64_t>(ZigzagEncode<std::uint64_t>(values[i]));
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kZigzagInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+   ZigzagDecode(reinterpret_cast<std::uint64_t *>(dst), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kZigzagInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastEncodeSplitPack<std::int32_t>(dst, src, count, [](const std::int32_t *values, std::size_t i) {
+      return static_cast<std::int32_t>(ZigzagEncode<std::uint32_t>(values[i]));
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kZigzagInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<kSize>(dst, src, count);
+   ZigzagDecode(reinterpret_cast<std::uint32_t *>(dst), count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto floatArray = reinterpret_cast<float *>(dst);
+   auto doubleArray = reinterpret_cast<const double *>(src);
+   for (std::size_t i = 0; i < count; ++i)
+      floatArray[i] = static_cast<float>(doubleArray[i]);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   auto doubleArray = reinterpret_cast<double *>(dst);
+   auto floatArray = reinterpret_cast<const float *>(src);
+   for (std::size_t i = 0; i < count; ++i)
+      doubleArray[i] = floatArray[i];
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackReducedPrecision<float, std::uint16_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackReducedPrecision<float, std::uint16_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal8>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackReducedPrecision<float, std::uint8_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal8>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackReducedPrecision<float, std::uint8_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackReducedPrecision<double, std::uint16_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackReducedPrecision<double, std::uint16_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal8>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackReducedPrecision<double, std::uint8_t>(dst, src, count, *this);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal8>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackReducedPrecision<double, std::uint8_t>(dst, src, count, *this);
+}
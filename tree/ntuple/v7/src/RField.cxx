@@ -121,6 +121,7 @@ void ROOT::Experimental::Detail::RFieldFuse::Connect(DescriptorId_t fieldId, RPa
       field.GenerateColumnsImpl();
    for (auto& column : field.fColumns)
       column->Connect(fieldId, &pageStorage);
+   field.fIsConnected = true;
 }
 
 
@@ -266,6 +267,33 @@ ROOT::Experimental::Detail::RFieldBase::SplitValue(const RFieldValue & /*value*/
    return std::vector<RFieldValue>();
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::Detail::RFieldBase::Clone(std::string_view newName) const
+{
+   auto clone = CloneImpl(newName);
+   if (clone)
+      clone->fColumnType = fColumnType;
+   return clone;
+}
+
+void ROOT::Experimental::Detail::RFieldBase::SetColumnType(EColumnType type)
+{
+   if (!fColumns.empty())
+      throw RException(R__FAIL("cannot change the column type of the connected field " + fName));
+   auto supportedTypes = GetSupportedColumnTypes();
+   if (std::find(supportedTypes.begin(), supportedTypes.end(), type) == supportedTypes.end())
+      throw RException(R__FAIL("unsupported column type for field " + fName + " of type " + fType));
+   fColumnType = type;
+}
+
+ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::GetColumnType() const
+{
+   if (fColumnType != EColumnType::kUnknown)
+      return fColumnType;
+   auto supportedTypes = GetSupportedColumnTypes();
+   return supportedTypes.empty() ? EColumnType::kUnknown : supportedTypes[0];
+}
+
 void ROOT::Experimental::Detail::RFieldBase::Attach(
    std::unique_ptr<ROOT::Experimental::Detail::RFieldBase> child)
 {
@@ -342,7 +370,7 @@ void ROOT::Experimental::Detail::RFieldBase::RSchemaIterator::Advance()
 
 
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
-ROOT::Experimental::RFieldZero::Clone(std::string_view /*newName*/) const
+ROOT::Experimental::RFieldZero::CloneImpl(std::string_view /*newName*/) const
 {
    auto result = std::make_unique<RFieldZero>();
    for (auto &f : fSubFields)
@@ -371,9 +399,8 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   RColumnModel model(GetColumnType(), true /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -418,12 +445,24 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+   RColumnModel model(GetColumnType(), false /* isSorted*/);
+   if (fHasValueRange && ((model.GetType() == EColumnType::kReal16) || (model.GetType() == EColumnType::kReal8)))
+      model.SetValueRange(fValueMin, fValueMax);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<float>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
+void ROOT::Experimental::RField<float>::SetValueRange(double min, double max)
+{
+   if (!fColumns.empty())
+      throw RException(R__FAIL("cannot change the value range of the connected field " + GetName()));
+   if (!(min < max))
+      throw RException(R__FAIL("invalid value range for field " + GetName()));
+   fHasValueRange = true;
+   fValueMin = min;
+   fValueMax = max;
+}
+
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitFloatField(*this);
@@ -434,12 +473,24 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+   RColumnModel model(GetColumnType(), false /* isSorted*/);
+   if (fHasValueRange && ((model.GetType() == EColumnType::kReal16) || (model.GetType() == EColumnType::kReal8)))
+      model.SetValueRange(fValueMin, fValueMax);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<double>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
+void ROOT::Experimental::RField<double>::SetValueRange(double min, double max)
+{
+   if (!fColumns.empty())
+      throw RException(R__FAIL("cannot change the value range of the connected field " + GetName()));
+   if (!(min < max))
+      throw RException(R__FAIL("invalid value range for field " + GetName()));
+   fHasValueRange = true;
+   fValueMin = min;
+   fValueMax = max;
+}
+
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitDoubleField(*this);
@@ -449,9 +500,8 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   RColumnModel model(GetColumnType(), false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<std::int32_t>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -464,9 +514,8 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+   RColumnModel model(GetColumnType(), false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<std::uint32_t>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -479,9 +528,8 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+   RColumnModel model(GetColumnType(), false /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<std::uint64_t>(model, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -495,9 +543,8 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   RColumnModel modelIndex(GetColumnType(), true /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(modelIndex, 0)));
 
    RColumnModel modelChars(EColumnType::kByte, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
@@ -561,7 +608,7 @@ ROOT::Experimental::RClassField::RClassField(std::string_view fieldName, std::st
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
-ROOT::Experimental::RClassField::Clone(std::string_view newName) const
+ROOT::Experimental::RClassField::CloneImpl(std::string_view newName) const
 {
    return std::make_unique<RClassField>(newName, GetType());
 }
@@ -658,7 +705,7 @@ ROOT::Experimental::RVectorField::RVectorField(
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
-ROOT::Experimental::RVectorField::Clone(std::string_view newName) const
+ROOT::Experimental::RVectorField::CloneImpl(std::string_view newName) const
 {
    auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
    return std::make_unique<RVectorField>(newName, std::move(newItemField));
@@ -694,9 +741,8 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   RColumnModel modelIndex(GetColumnType(), true /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(modelIndex, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -790,9 +836,8 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   RColumnModel modelIndex(GetColumnType(), true /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(modelIndex, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
@@ -843,7 +888,7 @@ ROOT::Experimental::RArrayField::RArrayField(
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
-ROOT::Experimental::RArrayField::Clone(std::string_view newName) const
+ROOT::Experimental::RArrayField::CloneImpl(std::string_view newName) const
 {
    auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
    return std::make_unique<RArrayField>(newName, std::move(newItemField), fArrayLength);
@@ -953,7 +998,7 @@ ROOT::Experimental::RVariantField::RVariantField(
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
-ROOT::Experimental::RVariantField::Clone(std::string_view newName) const
+ROOT::Experimental::RVariantField::CloneImpl(std::string_view newName) const
 {
    auto nFields = fSubFields.size();
    std::vector<Detail::RFieldBase *> itemFields;
@@ -1066,15 +1111,14 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   RColumnModel modelIndex(GetColumnType(), true /* isSorted*/);
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t>(modelIndex, 0)));
    fPrincipalColumn = fColumns[0].get();
 }
 
 
 std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
-ROOT::Experimental::RCollectionField::Clone(std::string_view /*newName*/) const
+ROOT::Experimental::RCollectionField::CloneImpl(std::string_view /*newName*/) const
 {
    // TODO(jblomer)
    return nullptr;
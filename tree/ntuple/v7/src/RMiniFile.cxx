@@ -32,6 +32,13 @@
 #include <utility>
 #include <chrono>
 
+#ifdef R__UNIX
+#include <cerrno>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
 namespace {
 
 // The following types are used to read and write the TFile binary format
@@ -897,6 +904,21 @@ public:
    }
 };
 
+/// The largest supported blob alignment; the padding goes into the key title, which holds at most 127 characters
+constexpr std::size_t kMaxBlobAlignment = 64;
+
+/// Returns a blob key title whose length pads the key header, such that the data record following the key at
+/// offsetKey starts at a multiple of alignment
+RTFString GetPaddingTitle(std::uint64_t offsetKey, std::uint64_t directoryOffset, std::size_t alignment)
+{
+   R__ASSERT(alignment > 0 && alignment <= kMaxBlobAlignment);
+   RTFString strClass{kBlobClassName};
+   RTFString strEmpty;
+   RTFKey key(offsetKey, directoryOffset, strClass, strEmpty, strEmpty, 0);
+   const auto offsetData = offsetKey + key.fKeyHeaderSize + strClass.GetSize() + 2 * strEmpty.GetSize();
+   return RTFString(std::string((alignment - offsetData % alignment) % alignment, '\0'));
+}
+
 } // anonymous namespace
 
 
@@ -1042,6 +1064,71 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Write(
 }
 
 
+void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::WriteV(const std::vector<RWriteBuffer> &buffers)
+{
+   R__ASSERT(fFile);
+#ifdef R__UNIX
+   // Linux and macOS accept up to 1024 buffers per call (IOV_MAX)
+   constexpr std::size_t kMaxIovecs = 1024;
+
+   // The stream buffer must reach the file before writing around the stream
+   auto retval = fflush(fFile);
+   R__ASSERT(retval == 0);
+   int fd = fileno(fFile);
+#ifdef R__SEEK64
+   auto newpos = lseek64(fd, fFilePos, SEEK_SET);
+#else
+   auto newpos = lseek(fd, fFilePos, SEEK_SET);
+#endif
+   R__ASSERT(newpos >= 0 && static_cast<std::uint64_t>(newpos) == fFilePos);
+
+   std::vector<struct iovec> iov;
+   std::size_t idxBuffer = 0;
+   // Number of bytes of buffers[idxBuffer] that have already been written by a previous short write
+   std::size_t nSkip = 0;
+   while (idxBuffer < buffers.size()) {
+      iov.clear();
+      for (auto i = idxBuffer; (i < buffers.size()) && (iov.size() < kMaxIovecs); ++i) {
+         const auto skip = (i == idxBuffer) ? nSkip : 0;
+         if (buffers[i].fSize == skip)
+            continue;
+         struct iovec v;
+         v.iov_base = const_cast<unsigned char *>(static_cast<const unsigned char *>(buffers[i].fBuffer) + skip);
+         v.iov_len = buffers[i].fSize - skip;
+         iov.emplace_back(v);
+      }
+      if (iov.empty())
+         break;
+
+      auto nWritten = writev(fd, iov.data(), iov.size());
+      if ((nWritten < 0) && (errno == EINTR))
+         continue;
+      R__ASSERT(nWritten > 0);
+      fFilePos += nWritten;
+
+      std::size_t nRemaining = nWritten;
+      while ((idxBuffer < buffers.size()) && (nRemaining >= buffers[idxBuffer].fSize - nSkip)) {
+         nRemaining -= buffers[idxBuffer].fSize - nSkip;
+         nSkip = 0;
+         ++idxBuffer;
+      }
+      nSkip += nRemaining;
+   }
+
+   // Synchronize the stream with the file descriptor position
+#ifdef R__SEEK64
+   retval = fseeko64(fFile, fFilePos, SEEK_SET);
+#else
+   retval = fseek(fFile, fFilePos, SEEK_SET);
+#endif
+   R__ASSERT(retval == 0);
+#else
+   for (const auto &b : buffers)
+      Write(b.fBuffer, b.fSize);
+#endif
+}
+
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::WriteKey(
    const void *buffer, std::size_t nbytes, std::size_t len, std::int64_t offset,
    std::uint64_t directoryOffset,
@@ -1082,17 +1169,20 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::Write(
 
 
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::WriteKey(
-   const void *buffer, size_t nbytes, size_t len)
+   const void *buffer, size_t nbytes, size_t len, std::size_t alignment)
 {
+   // The key position is only known after the reservation, so that space for the largest padding is reserved.
+   // The unused part of the padding trails the data record and is accounted to the record.
    std::uint64_t offsetKey;
    RKeyBlob keyBlob(fFile);
-   keyBlob.Reserve(nbytes, &offsetKey);
+   keyBlob.Reserve(nbytes + alignment - 1, &offsetKey);
 
    auto offset = offsetKey;
    RTFString strClass{kBlobClassName};
    RTFString strObject;
-   RTFString strTitle;
-   RTFKey keyHeader(offset, offset, strClass, strObject, strTitle, len, nbytes);
+   RTFString strTitle = GetPaddingTitle(offsetKey, offsetKey, alignment);
+   const std::size_t nTrailing = alignment - 1 - strTitle.fLName;
+   RTFKey keyHeader(offset, offset, strClass, strObject, strTitle, len + nTrailing, nbytes + nTrailing);
 
    Write(&keyHeader, keyHeader.fKeyHeaderSize, offset);
    offset += keyHeader.fKeyHeaderSize;
@@ -1104,6 +1194,10 @@ std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileProper::Writ
    offset += strTitle.GetSize();
    auto offsetData = offset;
    Write(buffer, nbytes, offset);
+   if (nTrailing > 0) {
+      const unsigned char zeros[kMaxBlobAlignment] = {0};
+      Write(zeros, nTrailing, offset + nbytes);
+   }
 
    return offsetData;
 }
@@ -1239,6 +1333,77 @@ std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteBlob(const v
 }
 
 
+void ROOT::Experimental::Internal::RNTupleFileWriter::WriteBlobV(std::vector<RBlobRequest> &requests)
+{
+   if (!fFileSimple) {
+      // TFile has no vector write interface; its keys are written one by one
+      for (auto &r : requests)
+         r.fOffset = fFileProper.WriteKey(r.fData, r.fNBytes, r.fLen, r.fAlignment);
+      return;
+   }
+
+   std::vector<RFileSimple::RWriteBuffer> buffers;
+   if (fIsBare) {
+      // Bare files have no key headers; aligned records are preceded by zero bytes
+      static const unsigned char zeros[kMaxBlobAlignment] = {0};
+      auto offset = fFileSimple.fFilePos;
+      for (auto &r : requests) {
+         R__ASSERT(r.fAlignment > 0 && r.fAlignment <= kMaxBlobAlignment);
+         const std::size_t nPadding = (r.fAlignment - offset % r.fAlignment) % r.fAlignment;
+         if (nPadding > 0)
+            buffers.push_back({zeros, nPadding});
+         offset += nPadding;
+         r.fOffset = offset;
+         offset += r.fNBytes;
+         buffers.push_back({r.fData, r.fNBytes});
+      }
+      fFileSimple.WriteV(buffers);
+      return;
+   }
+
+   // The key headers depend on their offset in the file, so that they are laid out first in a single scratch area
+   RTFString strClass{kBlobClassName};
+   RTFString strObject;
+   std::vector<RTFString> strTitles;
+   std::vector<std::size_t> keyHeaderSizes;
+   std::size_t nScratchBytes = 0;
+   auto offset = fFileSimple.fFilePos;
+   for (auto &r : requests) {
+      strTitles.emplace_back(GetPaddingTitle(offset, 100, r.fAlignment));
+      const auto &strTitle = strTitles.back();
+      RTFKey key(offset, 100, strClass, strObject, strTitle, r.fLen, r.fNBytes);
+      const std::size_t szKeyHeader =
+         key.fKeyHeaderSize + strClass.GetSize() + strObject.GetSize() + strTitle.GetSize();
+      keyHeaderSizes.emplace_back(szKeyHeader);
+      nScratchBytes += szKeyHeader;
+      offset += szKeyHeader;
+      r.fOffset = offset;
+      offset += r.fNBytes;
+   }
+
+   auto scratch = std::make_unique<unsigned char[]>(nScratchBytes);
+   auto pos = scratch.get();
+   for (std::size_t i = 0; i < requests.size(); ++i) {
+      const auto &r = requests[i];
+      const auto &strTitle = strTitles[i];
+      RTFKey key(r.fOffset - keyHeaderSizes[i], 100, strClass, strObject, strTitle, r.fLen, r.fNBytes);
+      auto keyStart = pos;
+      memcpy(pos, &key, key.fKeyHeaderSize);
+      pos += key.fKeyHeaderSize;
+      memcpy(pos, &strClass, strClass.GetSize());
+      pos += strClass.GetSize();
+      memcpy(pos, &strObject, strObject.GetSize());
+      pos += strObject.GetSize();
+      memcpy(pos, &strTitle, strTitle.GetSize());
+      pos += strTitle.GetSize();
+      R__ASSERT(static_cast<std::size_t>(pos - keyStart) == keyHeaderSizes[i]);
+      buffers.push_back({keyStart, keyHeaderSizes[i]});
+      buffers.push_back({r.fData, r.fNBytes});
+   }
+   fFileSimple.WriteV(buffers);
+}
+
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::WriteNTupleHeader(
    const void *data, size_t nbytes, size_t lenHeader)
 {
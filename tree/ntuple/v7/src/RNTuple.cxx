@@ -58,18 +58,28 @@ void ROOT::Experimental::RNTupleImtTaskScheduler::Wait()
 //------------------------------------------------------------------------------
 
 
-void ROOT::Experimental::RNTupleReader::ConnectModel(const RNTupleModel &model) {
+void ROOT::Experimental::RNTupleReader::VerifyModel(const RNTupleModel &model) {
+   const auto &desc = fSource->GetDescriptor();
    std::unordered_map<const Detail::RFieldBase *, DescriptorId_t> fieldPtr2Id;
-   fieldPtr2Id[model.GetFieldZero()] = fSource->GetDescriptor().GetFieldZeroId();
+   fieldPtr2Id[model.GetFieldZero()] = desc.GetFieldZeroId();
    for (auto &field : *model.GetFieldZero()) {
       auto parentId = fieldPtr2Id[field.GetParent()];
-      auto fieldId = fSource->GetDescriptor().FindFieldId(field.GetName(), parentId);
+      auto fieldId = desc.FindFieldId(field.GetName(), parentId);
       R__ASSERT(fieldId != kInvalidDescriptorId);
       fieldPtr2Id[&field] = fieldId;
-      Detail::RFieldFuse::Connect(fieldId, *fSource, field);
    }
 }
 
+void ROOT::Experimental::RNTupleReader::ConnectField(Detail::RFieldBase &field)
+{
+   // Values of an entry belong to top-level fields of the model
+   R__ASSERT(fModel && (field.GetParent() == fModel->GetFieldZero()));
+   const auto &desc = fSource->GetDescriptor();
+   auto fieldId = desc.FindFieldId(field.GetName(), desc.GetFieldZeroId());
+   R__ASSERT(fieldId != kInvalidDescriptorId);
+   Detail::RFieldFuse::ConnectRecursively(fieldId, *fSource, field);
+}
+
 void ROOT::Experimental::RNTupleReader::InitPageSource()
 {
 #ifdef R__USE_IMT
@@ -89,7 +99,7 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(
    , fMetrics("RNTupleReader")
 {
    InitPageSource();
-   ConnectModel(*fModel);
+   VerifyModel(*fModel);
 }
 
 ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> source)
@@ -126,10 +136,8 @@ std::unique_ptr<ROOT::Experimental::RNTupleReader> ROOT::Experimental::RNTupleRe
 
 ROOT::Experimental::RNTupleModel *ROOT::Experimental::RNTupleReader::GetModel()
 {
-   if (!fModel) {
+   if (!fModel)
       fModel = fSource->GetDescriptor().GenerateModel();
-      ConnectModel(*fModel);
-   }
    return fModel.get();
 }
 
@@ -255,6 +263,11 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    , fLastCommitted(0)
    , fNEntries(0)
 {
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled() && fSink->GetWriteOptions().GetUseParallelZip()) {
+      fSink->SetTaskScheduler(&fZipTasks);
+   }
+#endif
    fSink->Create(*fModel.get());
 }
 
@@ -262,6 +275,9 @@ ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
    CommitCluster();
    fSink->CommitDataset();
+#ifdef R__USE_IMT
+   fSink->SetTaskScheduler(nullptr);
+#endif
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleWriter> ROOT::Experimental::RNTupleWriter::Recreate(
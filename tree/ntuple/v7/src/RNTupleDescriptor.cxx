@@ -31,6 +31,10 @@
 
 namespace {
 
+/// Set in the footer flags (formerly a reserved field) if the footer contains the column and page statistics.
+/// The statistics follow the cluster list so that readers that do not know the flag ignore them.
+constexpr std::uint64_t kFooterFlagStatistics = 0x01;
+
 /// The machine-independent serialization of meta-data wraps the header and footer as well as sub structures in
 /// frames.  The frame layout is
 ///
@@ -143,6 +147,22 @@ std::uint32_t DeserializeUInt16(const void *buffer, std::uint16_t *val)
    return DeserializeInt16(buffer, reinterpret_cast<std::int16_t *>(val));
 }
 
+/// Doubles are stored as the little-endian representation of their IEEE 754 bit pattern
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
 std::uint32_t SerializeClusterSize(ROOT::Experimental::ClusterSize_t val, void *buffer)
 {
    return SerializeUInt32(val, buffer);
@@ -297,6 +317,9 @@ std::uint32_t SerializeColumnModel(const ROOT::Experimental::RColumnModel &val,
 
    pos += SerializeInt32(static_cast<int>(val.GetType()), *where);
    pos += SerializeInt32(static_cast<int>(val.GetIsSorted()), *where);
+   pos += SerializeInt32(static_cast<int>(val.HasValueRange()), *where);
+   pos += SerializeDouble(val.GetValueMin(), *where);
+   pos += SerializeDouble(val.GetValueMax(), *where);
 
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
@@ -315,6 +338,18 @@ std::uint32_t DeserializeColumnModel(const void *buffer, ROOT::Experimental::RCo
    bytes += DeserializeInt32(bytes, &isSorted);
    *columnModel = ROOT::Experimental::RColumnModel(static_cast<ROOT::Experimental::EColumnType>(type), isSorted);
 
+   // The value range has been added later to the frame; older frames end after the isSorted flag
+   if (static_cast<std::uint32_t>(bytes - reinterpret_cast<const unsigned char *>(buffer)) < frameSize) {
+      std::int32_t hasValueRange;
+      double min;
+      double max;
+      bytes += DeserializeInt32(bytes, &hasValueRange);
+      bytes += DeserializeDouble(bytes, &min);
+      bytes += DeserializeDouble(bytes, &max);
+      if (hasValueRange)
+         columnModel->SetValueRange(min, max);
+   }
+
    return frameSize;
 }
 
@@ -378,6 +413,31 @@ std::uint32_t DeserializePageInfo(const void *buffer,
    return bytes - base;
 }
 
+std::uint32_t SerializeStatistics(const ROOT::Experimental::RClusterDescriptor::RStatistics &val, void *buffer)
+{
+   // Like column ranges and page infos, statistics are not wrapped in a frame
+   if (buffer != nullptr) {
+      auto pos = reinterpret_cast<unsigned char *>(buffer);
+      pos += SerializeInt32(static_cast<int>(val.fHasRange), pos);
+      pos += SerializeDouble(val.fMin, pos);
+      pos += SerializeDouble(val.fMax, pos);
+      pos += SerializeUInt64(val.fNNull, pos);
+   }
+   return 28;
+}
+
+std::uint32_t DeserializeStatistics(const void *buffer, ROOT::Experimental::RClusterDescriptor::RStatistics *statistics)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   std::int32_t hasRange;
+   bytes += DeserializeInt32(bytes, &hasRange);
+   statistics->fHasRange = (hasRange != 0);
+   bytes += DeserializeDouble(bytes, &statistics->fMin);
+   bytes += DeserializeDouble(bytes, &statistics->fMax);
+   bytes += DeserializeUInt64(bytes, &statistics->fNNull);
+   return 28;
+}
+
 std::uint32_t SerializeCrc32(const unsigned char *data, std::uint32_t length, void *buffer)
 {
    auto checksum = R__crc32(0, nullptr, 0);
@@ -518,6 +578,17 @@ bool ROOT::Experimental::RColumnDescriptor::operator==(const RColumnDescriptor &
 ////////////////////////////////////////////////////////////////////////////////
 
 
+void ROOT::Experimental::RClusterDescriptor::RStatistics::Merge(const RStatistics &other)
+{
+   if (fHasRange && other.fHasRange) {
+      fMin = std::min(fMin, other.fMin);
+      fMax = std::max(fMax, other.fMax);
+   } else {
+      fHasRange = false;
+   }
+   fNNull += other.fNNull;
+}
+
 bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor &other) const {
    return fClusterId == other.fClusterId &&
           fVersion == other.fVersion &&
@@ -529,6 +600,21 @@ bool ROOT::Experimental::RClusterDescriptor::operator==(const RClusterDescriptor
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfoExtended
+ROOT::Experimental::RClusterDescriptor::RPageRange::Find(ClusterSize_t::ValueType idxInCluster) const
+{
+   R__ASSERT(fCumulativeNElements.size() == fPageInfos.size());
+   auto itr = std::upper_bound(fCumulativeNElements.begin(), fCumulativeNElements.end(), idxInCluster);
+   R__ASSERT(itr != fCumulativeNElements.end());
+
+   RPageInfoExtended pageInfo;
+   pageInfo.fPageNo = std::distance(fCumulativeNElements.begin(), itr);
+   static_cast<RPageInfo &>(pageInfo) = fPageInfos[pageInfo.fPageNo];
+   pageInfo.fFirstInPage = *itr - pageInfo.fNElements;
+   return pageInfo;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -544,7 +630,8 @@ bool ROOT::Experimental::RNTupleDescriptor::operator==(const RNTupleDescriptor &
           fGroupUuid == other.fGroupUuid &&
           fFieldDescriptors == other.fFieldDescriptors &&
           fColumnDescriptors == other.fColumnDescriptors &&
-          fClusterDescriptors == other.fClusterDescriptors;
+          fClusterDescriptors == other.fClusterDescriptors &&
+          fHasStatistics == other.fHasStatistics;
 }
 
 
@@ -593,7 +680,7 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
    void *ptrSize = nullptr;
    pos += SerializeFrame(
       RNTupleDescriptor::kFrameVersionCurrent, RNTupleDescriptor::kFrameVersionMin, *where, &ptrSize);
-   pos += SerializeUInt64(0, *where); // reserved; can be at some point used, e.g., for compression flags
+   pos += SerializeUInt64(fHasStatistics ? kFooterFlagStatistics : 0, *where);
 
    pos += SerializeUInt64(fClusterDescriptors.size(), *where);
    for (const auto& cluster : fClusterDescriptors) {
@@ -619,6 +706,19 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
       }
    }
 
+   for (const auto& cluster : fClusterDescriptors) {
+      if (!fHasStatistics)
+         break;
+      pos += SerializeUInt64(cluster.first, *where);
+      for (const auto& column : fColumnDescriptors) {
+         auto columnId = column.first;
+         pos += SerializeUInt64(columnId, *where);
+         pos += SerializeStatistics(cluster.second.GetColumnRange(columnId).fStatistics, *where);
+         for (const auto &pageInfo : cluster.second.GetPageRange(columnId).fPageInfos)
+            pos += SerializeStatistics(pageInfo.fStatistics, *where);
+      }
+   }
+
    // The next 16 bytes make the ntuple's postscript
    pos += SerializeUInt16(kFrameVersionCurrent, *where);
    pos += SerializeUInt16(kFrameVersionMin, *where);
@@ -733,6 +833,65 @@ ROOT::Experimental::RNTupleDescriptor::FindClusterId(DescriptorId_t columnId, NT
 }
 
 
+std::vector<std::pair<ROOT::Experimental::NTupleSize_t, ROOT::Experimental::NTupleSize_t>>
+ROOT::Experimental::RNTupleDescriptor::GetClusterEntryRanges() const
+{
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> result;
+   for (const auto &cd : fClusterDescriptors) {
+      if (cd.second.GetNEntries() == 0)
+         continue;
+      result.emplace_back(cd.second.GetFirstEntryIndex(), cd.second.GetFirstEntryIndex() + cd.second.GetNEntries());
+   }
+   std::sort(result.begin(), result.end());
+   return result;
+}
+
+
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleDescriptor::FindClustersInRange(DescriptorId_t columnId, double min, double max) const
+{
+   std::vector<std::pair<NTupleSize_t, DescriptorId_t>> candidates;
+   for (const auto &cd : fClusterDescriptors) {
+      if (cd.second.GetColumnRange(columnId).fStatistics.MayOverlap(min, max))
+         candidates.emplace_back(cd.second.GetFirstEntryIndex(), cd.first);
+   }
+   std::sort(candidates.begin(), candidates.end());
+
+   std::vector<DescriptorId_t> result;
+   for (const auto &c : candidates)
+      result.emplace_back(c.second);
+   return result;
+}
+
+
+std::vector<std::pair<ROOT::Experimental::NTupleSize_t, ROOT::Experimental::NTupleSize_t>>
+ROOT::Experimental::RNTupleDescriptor::FindElementRangesInRange(DescriptorId_t columnId, double min, double max) const
+{
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> candidates;
+   for (const auto &cd : fClusterDescriptors) {
+      const auto &columnRange = cd.second.GetColumnRange(columnId);
+      if (!columnRange.fStatistics.MayOverlap(min, max))
+         continue;
+      auto firstInPage = columnRange.fFirstElementIndex;
+      for (const auto &pageInfo : cd.second.GetPageRange(columnId).fPageInfos) {
+         if (pageInfo.fStatistics.MayOverlap(min, max))
+            candidates.emplace_back(firstInPage, firstInPage + pageInfo.fNElements);
+         firstInPage += pageInfo.fNElements;
+      }
+   }
+   std::sort(candidates.begin(), candidates.end());
+
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> result;
+   for (const auto &c : candidates) {
+      if (!result.empty() && result.back().second == c.first)
+         result.back().second = c.second;
+      else
+         result.emplace_back(c);
+   }
+   return result;
+}
+
+
 ROOT::Experimental::DescriptorId_t
 ROOT::Experimental::RNTupleDescriptor::FindNextClusterId(DescriptorId_t clusterId) const
 {
@@ -876,8 +1035,8 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
    std::uint32_t frameSize;
    pos += DeserializeFrame(RNTupleDescriptor::kFrameVersionCurrent, pos, &frameSize);
    VerifyCrc32(base, frameSize);
-   std::uint64_t reserved;
-   pos += DeserializeUInt64(pos, &reserved);
+   std::uint64_t flags;
+   pos += DeserializeUInt64(pos, &flags);
 
    std::uint64_t nClusters;
    pos += DeserializeUInt64(pos, &nClusters);
@@ -926,6 +1085,22 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
          AddClusterPageRange(clusterId, std::move(pageRange));
       }
    }
+
+   fDescriptor.fHasStatistics = (flags & kFooterFlagStatistics) != 0;
+   if (!fDescriptor.fHasStatistics)
+      return;
+   for (std::uint64_t i = 0; i < nClusters; ++i) {
+      std::uint64_t clusterId;
+      pos += DeserializeUInt64(pos, &clusterId);
+      auto &clusterDesc = fDescriptor.fClusterDescriptors.at(clusterId);
+      for (std::uint32_t j = 0; j < fDescriptor.GetNColumns(); ++j) {
+         std::uint64_t columnId;
+         pos += DeserializeUInt64(pos, &columnId);
+         pos += DeserializeStatistics(pos, &clusterDesc.fColumnRanges.at(columnId).fStatistics);
+         for (auto &pageInfo : clusterDesc.fPageRanges.at(columnId).fPageInfos)
+            pos += DeserializeStatistics(pos, &pageInfo.fStatistics);
+      }
+   }
 }
 
 void ROOT::Experimental::RNTupleDescriptorBuilder::SetNTuple(
@@ -1046,5 +1221,12 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterColumnRange(
 void ROOT::Experimental::RNTupleDescriptorBuilder::AddClusterPageRange(
    DescriptorId_t clusterId, RClusterDescriptor::RPageRange &&pageRange)
 {
+   pageRange.fCumulativeNElements.clear();
+   pageRange.fCumulativeNElements.reserve(pageRange.fPageInfos.size());
+   ClusterSize_t::ValueType nElements = 0;
+   for (const auto &pageInfo : pageRange.fPageInfos) {
+      nElements += pageInfo.fNElements;
+      pageRange.fCumulativeNElements.emplace_back(nElements);
+   }
    fDescriptor.fClusterDescriptors[clusterId].fPageRanges.emplace(pageRange.fColumnId, std::move(pageRange));
 }
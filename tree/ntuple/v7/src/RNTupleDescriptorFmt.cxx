@@ -84,10 +84,28 @@ static std::string GetColumnTypeName(ROOT::Experimental::EColumnType type)
       return "Real32";
    case ROOT::Experimental::EColumnType::kReal64:
       return "Real64";
+   case ROOT::Experimental::EColumnType::kReal16:
+      return "Real16";
+   case ROOT::Experimental::EColumnType::kReal8:
+      return "Real8";
    case ROOT::Experimental::EColumnType::kIndex:
       return "Index";
    case ROOT::Experimental::EColumnType::kSwitch:
       return "Switch";
+   case ROOT::Experimental::EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case ROOT::Experimental::EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case ROOT::Experimental::EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case ROOT::Experimental::EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case ROOT::Experimental::EColumnType::kDeltaIndex:
+      return "DeltaIndex";
+   case ROOT::Experimental::EColumnType::kZigzagInt64:
+      return "ZigzagInt64";
+   case ROOT::Experimental::EColumnType::kZigzagInt32:
+      return "ZigzagInt32";
    default:
       return "UNKNOWN";
    }
@@ -13,17 +13,69 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <TCollection.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+   // The inputs are the name of the ntuple, the output file, and the input files (see TFileMerger)
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetEntries() < 3) {
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+   auto outFile = dynamic_cast<TFile *>(itr());
+   if (outFile == nullptr) {
+      R__LOG_ERROR(NTupleLog()) << "cannot merge ntuple " << ntupleName << ": the output is not a file";
+      return -1;
+   }
+
+   try {
+      std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+      std::vector<Detail::RPageSource *> sourcePtrs;
+      while (auto input = itr()) {
+         auto inFile = dynamic_cast<TFile *>(input);
+         if (inFile == nullptr) {
+            R__LOG_ERROR(NTupleLog()) << "cannot merge ntuple " << ntupleName << ": input " << input->GetName()
+                                      << " is not a file";
+            return -1;
+         }
+         sources.emplace_back(
+            std::make_unique<Detail::RPageSourceFile>(ntupleName, inFile->GetName(), RNTupleReadOptions()));
+         sourcePtrs.emplace_back(sources.back().get());
+      }
+
+      RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(outFile->GetCompressionSettings());
+      Detail::RPageSinkFile destination(ntupleName, *outFile, writeOptions);
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination);
+   } catch (const RException &e) {
+      R__LOG_ERROR(NTupleLog()) << e.GetError().GetReport();
       return -1;
    }
-   return -1;
+   return 0;
 }
 
 
@@ -37,3 +89,134 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleMerger::MapColumns(const RNTupleDescriptor &destination, const RNTupleDescriptor &source)
+{
+   if ((destination.GetNFields() != source.GetNFields()) || (destination.GetNColumns() != source.GetNColumns()))
+      throw RException(R__FAIL("cannot merge ntuple " + source.GetName() + ": different number of fields or columns"));
+
+   std::vector<DescriptorId_t> columnMap(destination.GetNColumns(), kInvalidDescriptorId);
+   for (DescriptorId_t columnId = 0; columnId < destination.GetNColumns(); ++columnId) {
+      const auto &destColumn = destination.GetColumnDescriptor(columnId);
+      const auto &destField = destination.GetFieldDescriptor(destColumn.GetFieldId());
+      const auto fieldName = destination.GetQualifiedFieldName(destField.GetId());
+
+      const auto sourceFieldId = source.FindFieldId(fieldName);
+      if (sourceFieldId == kInvalidDescriptorId)
+         throw RException(R__FAIL("cannot merge ntuple " + source.GetName() + ": missing field " + fieldName));
+      if (source.GetFieldDescriptor(sourceFieldId).GetTypeName() != destField.GetTypeName())
+         throw RException(R__FAIL("cannot merge ntuple " + source.GetName() + ": type mismatch of field " + fieldName));
+
+      const auto sourceColumnId = source.FindColumnId(sourceFieldId, destColumn.GetIndex());
+      if ((sourceColumnId == kInvalidDescriptorId) ||
+          !(source.GetColumnDescriptor(sourceColumnId).GetModel() == destColumn.GetModel()))
+      {
+         throw RException(R__FAIL("cannot merge ntuple " + source.GetName() +
+                                  ": column representation mismatch of field " + fieldName));
+      }
+      columnMap[columnId] = sourceColumnId;
+   }
+   return columnMap;
+}
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(const std::vector<Detail::RPageSource *> &sources,
+                                              Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no sources to merge"));
+   for (auto source : sources)
+      source->Attach();
+
+   // Recreate the model of the first source including the column representations, so that the pages of the
+   // sources can be copied without unpacking
+   const auto &firstDesc = sources[0]->GetDescriptor();
+   auto model = firstDesc.GenerateModel();
+   std::unordered_map<const Detail::RFieldBase *, DescriptorId_t> fieldPtr2Id;
+   fieldPtr2Id[model->GetFieldZero()] = firstDesc.GetFieldZeroId();
+   for (auto &f : *model->GetFieldZero()) {
+      const auto fieldId = firstDesc.FindFieldId(f.GetName(), fieldPtr2Id.at(f.GetParent()));
+      R__ASSERT(fieldId != kInvalidDescriptorId);
+      fieldPtr2Id[&f] = fieldId;
+
+      const auto columnId = firstDesc.FindColumnId(fieldId, 0);
+      // Fields without a choice of column representation have an unknown column type
+      if (columnId == kInvalidDescriptorId || f.GetColumnType() == EColumnType::kUnknown)
+         continue;
+      const auto columnModel = firstDesc.GetColumnDescriptor(columnId).GetModel();
+      if (columnModel.GetType() != f.GetColumnType())
+         f.SetColumnType(columnModel.GetType());
+      if (columnModel.HasValueRange()) {
+         if (auto floatField = dynamic_cast<RField<float> *>(&f))
+            floatField->SetValueRange(columnModel.GetValueMin(), columnModel.GetValueMax());
+         else if (auto doubleField = dynamic_cast<RField<double> *>(&f))
+            doubleField->SetValueRange(columnModel.GetValueMin(), columnModel.GetValueMax());
+      }
+   }
+   destination.Create(*model);
+
+   const auto compression = destination.GetWriteOptions().GetCompression();
+   const auto &destDesc = destination.GetDescriptor();
+   Detail::RNTupleDecompressor decompressor;
+   std::vector<unsigned char> pageBuffer;
+   std::vector<unsigned char> zipBuffer;
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      const auto &sourceDesc = source->GetDescriptor();
+      const auto columnMap = MapColumns(destDesc, sourceDesc);
+
+      Detail::RPageSource::ColumnSet_t columnSet(columnMap.begin(), columnMap.end());
+
+      // The page sinks issue cluster ids sequentially in the order of the entries
+      for (DescriptorId_t clusterId = 0; clusterId < sourceDesc.GetNClusters(); ++clusterId) {
+         const auto &clusterDesc = sourceDesc.GetClusterDescriptor(clusterId);
+         // Fetches the pages of all the columns of the cluster with a single vector read
+         auto cluster = source->LoadCluster(clusterId, columnSet);
+         for (DescriptorId_t columnId = 0; columnId < columnMap.size(); ++columnId) {
+            const auto sourceColumnId = columnMap[columnId];
+            const auto needsRecompression =
+               clusterDesc.GetColumnRange(sourceColumnId).fCompressionSettings != compression;
+            const auto columnType = destDesc.GetColumnDescriptor(columnId).GetModel().GetType();
+
+            const auto &pageRange = clusterDesc.GetPageRange(sourceColumnId);
+            for (std::size_t pageNo = 0; pageNo < pageRange.fPageInfos.size(); ++pageNo) {
+               const auto &pageInfo = pageRange.fPageInfos[pageNo];
+               Detail::RPageStorage::RSealedPage sealedPage;
+               if (auto onDiskPage = cluster->GetOnDiskPage(Detail::ROnDiskPage::Key(sourceColumnId, pageNo))) {
+                  sealedPage.fBuffer = onDiskPage->GetAddress();
+                  sealedPage.fSize = onDiskPage->GetSize();
+                  sealedPage.fNElements = pageInfo.fNElements;
+               } else {
+                  // Page sources may leave out pages that they can serve otherwise, e.g. memory mapped pages
+                  const RClusterIndex clusterIndex(clusterId, pageRange.fCumulativeNElements[pageNo] -
+                                                              pageInfo.fNElements);
+                  pageBuffer.resize(pageInfo.fLocator.fBytesOnStorage);
+                  sealedPage.fBuffer = pageBuffer.data();
+                  source->LoadSealedPage(sourceColumnId, clusterIndex, sealedPage);
+               }
+
+               if (needsRecompression) {
+                  const auto packedBytes =
+                     (sealedPage.fNElements * Detail::RColumnElementBase::GetBitsOnStorage(columnType) + 7) / 8;
+                  zipBuffer.resize(packedBytes);
+                  decompressor(sealedPage.fBuffer, sealedPage.fSize, packedBytes, zipBuffer.data());
+                  pageBuffer.resize(packedBytes);
+                  sealedPage.fBuffer = pageBuffer.data();
+                  sealedPage.fSize =
+                     Detail::RNTupleCompressor::Zip(zipBuffer.data(), packedBytes, compression, pageBuffer.data());
+               }
+
+               destination.CommitSealedPage(columnId, sealedPage, pageInfo.fStatistics);
+            }
+         }
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+   destination.CommitDataset();
+}
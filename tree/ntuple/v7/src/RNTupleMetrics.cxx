@@ -15,10 +15,83 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <cmath>
+#include <cstdio>
 #include <ostream>
 
 #include <iostream>
 
+namespace {
+
+/// Escapes quotes, backslashes, and control characters for use in a JSON string
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+/// Prometheus metric names must match [a-zA-Z_:][a-zA-Z0-9_:]*; other characters are replaced by an underscore
+std::string SanitizePrometheusName(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      bool isValid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c == '_') || (c == ':') ||
+                     (!result.empty() && c >= '0' && c <= '9');
+      result += isValid ? c : '_';
+   }
+   return result;
+}
+
+/// Units are kept as they are (no conversion to base units) but spelled out in the metric name suffix
+std::string GetPrometheusUnitSuffix(const std::string &unit)
+{
+   if (unit.empty())
+      return "";
+   std::string suffix;
+   for (auto c : unit) {
+      if (c == '/')
+         suffix += "_per_";
+      else
+         suffix += c;
+   }
+   if (suffix == "B")
+      suffix = "bytes";
+   return "_" + SanitizePrometheusName(suffix);
+}
+
+/// HELP lines escape backslashes and line breaks
+std::string EscapePrometheusHelp(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      if (c == '\\')
+         result += "\\\\";
+      else if (c == '\n')
+         result += "\\n";
+      else
+         result += c;
+   }
+   return result;
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
 {
 }
@@ -74,6 +147,54 @@ void ROOT::Experimental::Detail::RNTupleMetrics::Print(std::ostream &output, con
    }
 }
 
+void ROOT::Experimental::Detail::RNTupleMetrics::VisitCounters(const CounterVisitor_t &visitor,
+                                                               const std::string &prefix) const
+{
+   for (const auto &c : fCounters) {
+      visitor(prefix + fName + kNamespaceSeperator + c->GetName(), *c);
+   }
+   for (const auto m : fObservedMetrics) {
+      m->VisitCounters(visitor, prefix + fName + kNamespaceSeperator);
+   }
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSON(std::ostream &output) const
+{
+   output << "{";
+   bool isFirst = true;
+   VisitCounters([&](const std::string &qualifiedName, const RNTuplePerfCounter &counter) {
+      output << (isFirst ? "\n" : ",\n");
+      isFirst = false;
+      output << "  \"" << EscapeJSON(qualifiedName) << "\": {\"value\": ";
+      if (std::isfinite(counter.GetValueAsDouble()))
+         output << counter.GetValueAsString();
+      else
+         output << "null";
+      output << ", \"unit\": \"" << EscapeJSON(counter.GetUnit()) << "\""
+             << ", \"description\": \"" << EscapeJSON(counter.GetDescription()) << "\"}";
+   });
+   output << (isFirst ? "}" : "\n}") << std::endl;
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintPrometheus(std::ostream &output) const
+{
+   VisitCounters([&](const std::string &qualifiedName, const RNTuplePerfCounter &counter) {
+      auto name = SanitizePrometheusName(qualifiedName) + GetPrometheusUnitSuffix(counter.GetUnit());
+      output << "# HELP " << name << " " << EscapePrometheusHelp(counter.GetDescription()) << "\n";
+      output << "# TYPE " << name << " gauge\n";
+      output << name << " ";
+      auto value = counter.GetValueAsDouble();
+      if (std::isnan(value))
+         output << "NaN";
+      else if (std::isinf(value))
+         output << (value > 0 ? "+Inf" : "-Inf");
+      else
+         output << counter.GetValueAsString();
+      output << "\n";
+   });
+   output << std::flush;
+}
+
 void ROOT::Experimental::Detail::RNTupleMetrics::Enable()
 {
    for (auto &c: fCounters)
@@ -87,3 +208,67 @@ void ROOT::Experimental::Detail::RNTupleMetrics::ObserveMetrics(RNTupleMetrics &
 {
    fObservedMetrics.push_back(&observee);
 }
+
+std::unique_ptr<ROOT::Experimental::Detail::RNTupleMetrics>
+ROOT::Experimental::Detail::RNTupleMetrics::TakeSnapshot() const
+{
+   // The snapshot is heap allocated because its calculated counters keep a reference to it
+   auto snapshot = std::make_unique<RNTupleMetrics>(fName);
+   for (const auto &c : fCounters) {
+      // Atomic tick counters derive from RNTupleAtomicCounter, too
+      if (dynamic_cast<const RNTupleAtomicCounter *>(c.get()) != nullptr) {
+         auto copy = snapshot->MakeCounter<RNTuplePlainCounter *>(c->GetName(), c->GetUnit(), c->GetDescription());
+         copy->SetValue(c->GetValueAsInt());
+      } else if (auto calc = dynamic_cast<const RNTupleCalcPerf *>(c.get())) {
+         snapshot->MakeCounter<RNTupleCalcPerf *>(c->GetName(), c->GetUnit(), c->GetDescription(), *snapshot,
+                                                  RNTupleCalcPerf::MetricFunc_t(calc->GetFunc()));
+      }
+   }
+   for (const auto m : fObservedMetrics) {
+      snapshot->fOwnedMetrics.emplace_back(m->TakeSnapshot());
+      snapshot->ObserveMetrics(*snapshot->fOwnedMetrics.back());
+   }
+   if (fIsEnabled)
+      snapshot->Enable();
+   return snapshot;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::Detail::RNTupleMetricsSampler::RNTupleMetricsSampler(
+   const RNTupleMetrics &metrics, std::chrono::milliseconds interval, Callback_t callback)
+   : fMetrics(metrics), fInterval(interval), fCallback(std::move(callback))
+{
+   R__ASSERT(fCallback);
+   fThread = std::thread(&RNTupleMetricsSampler::ExecSample, this);
+}
+
+ROOT::Experimental::Detail::RNTupleMetricsSampler::~RNTupleMetricsSampler()
+{
+   Stop();
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsSampler::ExecSample()
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   while (!fCvStop.wait_for(lock, fInterval, [this]{ return fIsStopped; })) {
+      lock.unlock();
+      fCallback(*fMetrics.TakeSnapshot());
+      lock.lock();
+   }
+}
+
+void ROOT::Experimental::Detail::RNTupleMetricsSampler::Stop()
+{
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      if (fIsStopped)
+         return;
+      fIsStopped = true;
+   }
+   fCvStop.notify_one();
+   fThread.join();
+   fCallback(*fMetrics.TakeSnapshot());
+}
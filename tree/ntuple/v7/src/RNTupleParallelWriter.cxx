@@ -0,0 +1,98 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelWriter.hxx>
+
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+
+#include <utility>
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(RNTupleParallelWriter &writer,
+                                                           std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSinkBuf> sink)
+   : fWriter(writer), fSink(std::move(sink)), fModel(std::move(model)), fClusterSizeEntries(kDefaultClusterSizeEntries)
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) return;
+   for (auto& field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   auto columns = fSink->ReleaseCluster();
+   const auto nEntries = fNEntries - fLastCommitted;
+
+   // The column ids of the buffer sink match the ones of the shared sink because both are created from equal models
+   std::lock_guard<std::mutex> guard(fWriter.fMutex);
+   for (std::size_t i = 0; i < columns.size(); ++i) {
+      for (const auto &bufPage : columns[i]) {
+         fWriter.fSink->CommitSealedPage(i, bufPage.fSealedPage, bufPage.fStatistics);
+      }
+   }
+   fWriter.fNEntries += nEntries;
+   fWriter.fSink->CommitCluster(fWriter.fNEntries);
+   fLastCommitted = fNEntries;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> ROOT::Experimental::RNTupleParallelWriter::Recreate(
+   std::unique_ptr<RNTupleModel> model,
+   std::string_view ntupleName,
+   std::string_view storage,
+   const RNTupleWriteOptions &options)
+{
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, options));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   auto model = fModel->Clone();
+   auto sink = std::make_unique<Detail::RPageSinkBuf>("", fSink->GetWriteOptions());
+   // The constructor of the fill context is private, so std::make_shared cannot be used
+   return std::shared_ptr<RNTupleFillContext>(new RNTupleFillContext(*this, std::move(model), std::move(sink)));
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   return fNEntries;
+}
@@ -18,6 +18,144 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+using RPageAllocatorPool = ROOT::Experimental::Detail::RPageAllocatorPool;
+
+constexpr std::size_t kMinClassLog2 = 6;
+constexpr std::size_t kMaxClassLog2 = 26;
+constexpr std::size_t kClassesPerPowerOfTwo = 4;
+constexpr std::size_t kNClasses = 1 + (kMaxClassLog2 - kMinClassLog2) * kClassesPerPowerOfTwo;
+constexpr std::size_t kNoClass = std::size_t(-1);
+static_assert(RPageAllocatorPool::kMinClassBytes == (std::size_t(1) << kMinClassLog2), "inconsistent size classes");
+static_assert(RPageAllocatorPool::kMaxClassBytes == (std::size_t(1) << kMaxClassLog2), "inconsistent size classes");
+
+/// Returns the index of the smallest size class that can hold nbytes and sets classBytes to the size of that class.
+/// Returns kNoClass for blocks larger than the largest class, which are not recycled.
+std::size_t GetSizeClass(std::size_t nbytes, std::size_t &classBytes)
+{
+   if (nbytes <= RPageAllocatorPool::kMinClassBytes) {
+      classBytes = RPageAllocatorPool::kMinClassBytes;
+      return 0;
+   }
+   if (nbytes > RPageAllocatorPool::kMaxClassBytes) {
+      classBytes = nbytes;
+      return kNoClass;
+   }
+   // Find k with 2^k < nbytes <= 2^(k+1); the classes in this interval are 2^k + j * 2^k / 4 for j = 1..4
+   std::size_t k = kMinClassLog2;
+   while ((std::size_t(1) << (k + 1)) < nbytes)
+      ++k;
+   const std::size_t base = std::size_t(1) << k;
+   const std::size_t step = base / kClassesPerPowerOfTwo;
+   const std::size_t j = (nbytes - base + step - 1) / step;
+   classBytes = base + j * step;
+   return 1 + (k - kMinClassLog2) * kClassesPerPowerOfTwo + (j - 1);
+}
+
+/// Free blocks, one list per size class
+struct RFreeLists {
+   std::array<std::vector<unsigned char *>, kNClasses> fBlocks;
+   /// The sum of the sizes of all the blocks in the lists
+   std::size_t fBytes = 0;
+
+   unsigned char *Pop(std::size_t sizeClass, std::size_t classBytes)
+   {
+      auto &list = fBlocks[sizeClass];
+      if (list.empty())
+         return nullptr;
+      auto block = list.back();
+      list.pop_back();
+      fBytes -= classBytes;
+      return block;
+   }
+
+   void Push(unsigned char *block, std::size_t sizeClass, std::size_t classBytes)
+   {
+      fBlocks[sizeClass].emplace_back(block);
+      fBytes += classBytes;
+   }
+
+   /// Frees blocks, starting with the largest ones, until at most maxBytes are retained
+   void Trim(std::size_t maxBytes)
+   {
+      for (std::size_t i = kNClasses; (i > 0) && (fBytes > maxBytes); --i) {
+         auto &list = fBlocks[i - 1];
+         while (!list.empty() && (fBytes > maxBytes)) {
+            delete[] list.back();
+            list.pop_back();
+            fBytes -= GetClassBytes(i - 1);
+         }
+      }
+   }
+
+   static std::size_t GetClassBytes(std::size_t sizeClass)
+   {
+      if (sizeClass == 0)
+         return RPageAllocatorPool::kMinClassBytes;
+      const std::size_t k = kMinClassLog2 + (sizeClass - 1) / kClassesPerPowerOfTwo;
+      const std::size_t j = 1 + (sizeClass - 1) % kClassesPerPowerOfTwo;
+      return (std::size_t(1) << k) + j * ((std::size_t(1) << k) / kClassesPerPowerOfTwo);
+   }
+};
+
+/// Blocks that do not fit in the cache of the releasing thread; shared by all threads
+struct RDepot {
+   std::mutex fLock;
+   RFreeLists fLists;
+   std::atomic<std::size_t> fMaxBytes{RPageAllocatorPool::kDefaultMaxRetainedBytes};
+};
+
+/// Never destructed so that pages can still be released during static destruction
+RDepot &GetDepot()
+{
+   static RDepot *depot = new RDepot();
+   return *depot;
+}
+
+/// On thread exit, the cached blocks move to the depot as far as it has room for them
+struct RThreadCache {
+   RFreeLists fLists;
+   ~RThreadCache();
+};
+
+/// Set once the cache of the thread is gone; trivially destructible and thus safe to query during thread exit
+thread_local bool gThreadCacheDestroyed = false;
+
+RThreadCache::~RThreadCache()
+{
+   gThreadCacheDestroyed = true;
+   auto &depot = GetDepot();
+   std::lock_guard<std::mutex> guard(depot.fLock);
+   const auto maxBytes = depot.fMaxBytes.load();
+   for (std::size_t i = 0; i < kNClasses; ++i) {
+      const auto classBytes = RFreeLists::GetClassBytes(i);
+      for (auto block : fLists.fBlocks[i]) {
+         if (depot.fLists.fBytes + classBytes <= maxBytes)
+            depot.fLists.Push(block, i, classBytes);
+         else
+            delete[] block;
+      }
+   }
+}
+
+/// Returns nullptr if the calling thread is about to exit
+RFreeLists *GetThreadCache()
+{
+   if (gThreadCacheDestroyed)
+      return nullptr;
+   thread_local RThreadCache cache;
+   return &cache.fLists;
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(
    ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
 {
@@ -31,3 +169,99 @@ void ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(const RPage& pag
 {
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+unsigned char *ROOT::Experimental::Detail::RPageAllocatorPool::Allocate(std::size_t nbytes)
+{
+   std::size_t classBytes;
+   const auto sizeClass = GetSizeClass(nbytes, classBytes);
+   if (sizeClass == kNoClass)
+      return new unsigned char[nbytes];
+
+   if (auto cache = GetThreadCache()) {
+      if (auto block = cache->Pop(sizeClass, classBytes))
+         return block;
+   }
+   {
+      auto &depot = GetDepot();
+      std::lock_guard<std::mutex> guard(depot.fLock);
+      if (auto block = depot.fLists.Pop(sizeClass, classBytes))
+         return block;
+   }
+   return new unsigned char[classBytes];
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorPool::Release(void *buffer, std::size_t nbytes)
+{
+   if (buffer == nullptr)
+      return;
+   auto block = reinterpret_cast<unsigned char *>(buffer);
+   std::size_t classBytes;
+   const auto sizeClass = GetSizeClass(nbytes, classBytes);
+   if (sizeClass == kNoClass) {
+      delete[] block;
+      return;
+   }
+
+   auto &depot = GetDepot();
+   const auto maxBytes = depot.fMaxBytes.load();
+   if (auto cache = GetThreadCache()) {
+      if (cache->fBytes + classBytes <= std::min(kMaxThreadCacheBytes, maxBytes)) {
+         cache->Push(block, sizeClass, classBytes);
+         return;
+      }
+   }
+   {
+      std::lock_guard<std::mutex> guard(depot.fLock);
+      if (depot.fLists.fBytes + classBytes <= maxBytes) {
+         depot.fLists.Push(block, sizeClass, classBytes);
+         return;
+      }
+   }
+   delete[] block;
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorPool::NewPage(
+   ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   auto nbytes = elementSize * nElements;
+   return RPage(columnId, Allocate(nbytes), nbytes, elementSize);
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorPool::DeletePage(const RPage &page)
+{
+   if (page.IsNull())
+      return;
+   Release(page.GetBuffer(), page.GetCapacity());
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorPool::SetMaxRetainedBytes(std::size_t nbytes)
+{
+   auto &depot = GetDepot();
+   {
+      std::lock_guard<std::mutex> guard(depot.fLock);
+      depot.fMaxBytes = nbytes;
+      depot.fLists.Trim(nbytes);
+   }
+   if (auto cache = GetThreadCache())
+      cache->Trim(std::min(kMaxThreadCacheBytes, nbytes));
+}
+
+std::size_t ROOT::Experimental::Detail::RPageAllocatorPool::GetMaxRetainedBytes()
+{
+   return GetDepot().fMaxBytes.load();
+}
+
+std::size_t ROOT::Experimental::Detail::RPageAllocatorPool::GetRetainedBytes()
+{
+   std::size_t result = 0;
+   if (auto cache = GetThreadCache())
+      result += cache->fBytes;
+   auto &depot = GetDepot();
+   std::lock_guard<std::mutex> guard(depot.fLock);
+   return result + depot.fLists.fBytes;
+}
@@ -18,6 +18,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <cstdlib>
 
 void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
@@ -28,12 +29,73 @@ void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, cons
    fDeleters.emplace_back(deleter);
 }
 
+void ROOT::Experimental::Detail::RPagePool::ErasePendingPage(ColumnId_t columnId, NTupleSize_t rangeFirst)
+{
+   auto N = fPendingPages.size();
+   for (unsigned int i = 0; i < N; ++i) {
+      if ((fPendingPages[i].fColumnId != columnId) || (fPendingPages[i].fRangeFirst != rangeFirst))
+         continue;
+      fPendingPages[i] = fPendingPages[N - 1];
+      fPendingPages.resize(N - 1);
+      return;
+   }
+}
+
 void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const RPageDeleter &deleter)
+{
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      fPages.emplace_back(page);
+      fReferences.emplace_back(0);
+      fDeleters.emplace_back(deleter);
+      ErasePendingPage(page.GetColumnId(), page.GetGlobalRangeFirst());
+   }
+   fCvPagePreloaded.notify_all();
+}
+
+void ROOT::Experimental::Detail::RPagePool::DiscardPendingPage(ColumnId_t columnId, NTupleSize_t rangeFirst)
+{
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      ErasePendingPage(columnId, rangeFirst);
+   }
+   fCvPagePreloaded.notify_all();
+}
+
+void ROOT::Experimental::Detail::RPagePool::AnnouncePage(ColumnId_t columnId, NTupleSize_t rangeFirst,
+                                                         ClusterSize_t::ValueType nElements,
+                                                         const RPage::RClusterInfo &clusterInfo)
 {
    std::lock_guard<std::mutex> lockGuard(fLock);
-   fPages.emplace_back(page);
-   fReferences.emplace_back(0);
-   fDeleters.emplace_back(deleter);
+   RPendingPage pendingPage;
+   pendingPage.fColumnId = columnId;
+   pendingPage.fRangeFirst = rangeFirst;
+   pendingPage.fNElements = nElements;
+   pendingPage.fClusterInfo = clusterInfo;
+   fPendingPages.emplace_back(pendingPage);
+}
+
+template <typename IndexT>
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::WaitForPage(
+   std::unique_lock<std::mutex> &lock, ColumnId_t columnId, const IndexT &index)
+{
+   while (true) {
+      unsigned int N = fPages.size();
+      for (unsigned int i = 0; i < N; ++i) {
+         if (fReferences[i] < 0) continue;
+         if (fPages[i].GetColumnId() != columnId) continue;
+         if (!fPages[i].Contains(index)) continue;
+         fReferences[i]++;
+         return fPages[i];
+      }
+
+      auto isPending = std::any_of(fPendingPages.begin(), fPendingPages.end(), [&](const RPendingPage &p) {
+         return (p.fColumnId == columnId) && p.Contains(index);
+      });
+      if (!isPending)
+         return RPage();
+      fCvPagePreloaded.wait(lock);
+   }
 }
 
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
@@ -62,29 +124,13 @@ void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, NTupleSize_t globalIndex)
 {
-   std::lock_guard<std::mutex> lockGuard(fLock);
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] < 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(globalIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
-   }
-   return RPage();
+   std::unique_lock<std::mutex> lock(fLock);
+   return WaitForPage(lock, columnId, globalIndex);
 }
 
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, const RClusterIndex &clusterIndex)
 {
-   std::lock_guard<std::mutex> lockGuard(fLock);
-   unsigned int N = fPages.size();
-   for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] < 0) continue;
-      if (fPages[i].GetColumnId() != columnId) continue;
-      if (!fPages[i].Contains(clusterIndex)) continue;
-      fReferences[i]++;
-      return fPages[i];
-   }
-   return RPage();
+   std::unique_lock<std::mutex> lock(fLock);
+   return WaitForPage(lock, columnId, clusterIndex);
 }
@@ -0,0 +1,116 @@
+/// \file RPageSinkBuf.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+#include <ROOT/RPageStorageFile.hxx>
+
+#include <TError.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::string_view ntupleName,
+                                                       const RNTupleWriteOptions &options)
+   : RPageSink(ntupleName, options), fMetrics("RPageSinkBuf")
+{
+}
+
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel & /* model */)
+{
+   fBufferedColumns.resize(fOpenColumnRanges.size());
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   // The page buffer is reused by the column after CommitPage() returns, so the sealed page needs its own buffer
+   RBufferedPage bufPage;
+   bufPage.fBuffer = RPageAllocatorPool::MakeBuffer(page.GetSize());
+   bufPage.fSealedPage =
+      SealPage(page, *columnHandle.fColumn->GetElement(), fOptions.GetCompression(), bufPage.fBuffer.get());
+   fBufferedBytes += bufPage.fSealedPage.fSize;
+   fBufferedColumns[columnHandle.fId].emplace_back(std::move(bufPage));
+   // The page is not yet written; the actual page sink issues the locator
+   return RClusterDescriptor::RLocator();
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   RBufferedPage bufPage;
+   bufPage.fBuffer = RPageAllocatorPool::MakeBuffer(sealedPage.fSize);
+   memcpy(bufPage.fBuffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+   bufPage.fSealedPage = sealedPage;
+   bufPage.fSealedPage.fBuffer = bufPage.fBuffer.get();
+   fBufferedBytes += sealedPage.fSize;
+   fBufferedColumns[columnId].emplace_back(std::move(bufPage));
+   return RClusterDescriptor::RLocator();
+}
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(NTupleSize_t /* nEntries */)
+{
+   // Clusters are committed by the owner of the buffer sink to the actual page sink
+   return RClusterDescriptor::RLocator();
+}
+
+std::vector<ROOT::Experimental::Detail::RPageSinkBuf::ColumnBuffer_t>
+ROOT::Experimental::Detail::RPageSinkBuf::ReleaseCluster()
+{
+   std::vector<ColumnBuffer_t> result(fBufferedColumns.size());
+   std::swap(result, fBufferedColumns);
+   fBufferedBytes = 0;
+
+   // The base class computed the page statistics; its page infos are in the same order as the buffered pages
+   for (std::size_t i = 0; i < result.size(); ++i) {
+      auto &pageInfos = fOpenPageRanges[i].fPageInfos;
+      R__ASSERT(pageInfos.size() == result[i].size());
+      for (std::size_t j = 0; j < pageInfos.size(); ++j)
+         result[i][j].fStatistics = pageInfos[j].fStatistics;
+   }
+
+   // Otherwise, the page and element bookkeeping of the base class is not used by the buffer sink; keep it from
+   // growing
+   for (auto &range : fOpenColumnRanges) {
+      range.fFirstElementIndex += range.fNElements;
+      range.fNElements = 0;
+      range.fStatistics = RClusterDescriptor::RStatistics();
+   }
+   for (auto &range : fOpenPageRanges)
+      range.fPageInfos.clear();
+   std::fill(fOpenLastOffsets.begin(), fOpenLastOffsets.end(), 0);
+
+   return result;
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkBuf::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = RPageSinkFile::kDefaultElementsPerPage;
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorPool::NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
+{
+   RPageAllocatorPool::DeletePage(page);
+}
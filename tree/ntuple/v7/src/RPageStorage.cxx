@@ -15,11 +15,13 @@
 
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
@@ -27,6 +29,7 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -70,13 +73,25 @@ ROOT::Experimental::Detail::RPageSource::AddColumn(DescriptorId_t fieldId, const
    R__ASSERT(fieldId != kInvalidDescriptorId);
    auto columnId = fDescriptor.FindColumnId(fieldId, column.GetIndex());
    R__ASSERT(columnId != kInvalidDescriptorId);
-   fActiveColumns.emplace(columnId);
+   if (fActiveColumnRefs[columnId]++ == 0)
+      fActiveColumns.emplace(columnId);
+   {
+      std::lock_guard<std::mutex> guard(fLockActiveElements);
+      fActiveElements[columnId] = column.GenerateElement(fDescriptor.GetColumnDescriptor(columnId).GetModel());
+   }
    return ColumnHandle_t{columnId, &column};
 }
 
 void ROOT::Experimental::Detail::RPageSource::DropColumn(ColumnHandle_t columnHandle)
 {
+   auto itr = fActiveColumnRefs.find(columnHandle.fId);
+   R__ASSERT(itr != fActiveColumnRefs.end());
+   if (--itr->second > 0)
+      return;
+   fActiveColumnRefs.erase(itr);
    fActiveColumns.erase(columnHandle.fId);
+   std::lock_guard<std::mutex> guard(fLockActiveElements);
+   fActiveElements.erase(columnHandle.fId);
 }
 
 ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEntries()
@@ -95,10 +110,43 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSource::LoadClusters(const std::vector<RCluster::RKey> &clusterKeys)
+{
+   std::vector<std::unique_ptr<RCluster>> clusters;
+   for (const auto &key : clusterKeys)
+      clusters.emplace_back(LoadCluster(key.fClusterId, key.fColumnSet));
+   return clusters;
+}
+
+std::shared_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RPageSource::GetActiveElement(DescriptorId_t columnId)
+{
+   std::lock_guard<std::mutex> guard(fLockActiveElements);
+   auto itr = fActiveElements.find(columnId);
+   if (itr != fActiveElements.end())
+      return itr->second;
+   // The column is not (anymore) connected; unpack to the default in-memory type of the on-disk column type
+   return RColumnElementBase::Generate(fDescriptor.GetColumnDescriptor(columnId).GetModel().GetType());
+}
+
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
-   if (fTaskScheduler)
-      UnzipClusterImpl(cluster);
+   if (!fTaskScheduler)
+      return;
+   if (!fHasUnzipTasks) {
+      fTaskScheduler->Reset();
+      fHasUnzipTasks = true;
+   }
+   UnzipClusterImpl(cluster);
+}
+
+void ROOT::Experimental::Detail::RPageSource::WaitForUnzip()
+{
+   if (!fHasUnzipTasks)
+      return;
+   fTaskScheduler->Wait();
+   fHasUnzipTasks = false;
 }
 
 
@@ -133,6 +181,7 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
 {
    fDescriptorBuilder.SetNTuple(fNTupleName, model.GetDescription(), "undefined author",
                                 model.GetVersion(), model.GetUuid());
+   fDescriptorBuilder.SetHasStatistics(fOptions.GetComputeStatistics());
 
    std::unordered_map<const RFieldBase *, DescriptorId_t> fieldPtr2Id; // necessary to find parent field ids
    const auto &fieldZero = *model.GetFieldZero();
@@ -167,21 +216,107 @@ void ROOT::Experimental::Detail::RPageSink::Create(RNTupleModel &model)
       pageRange.fColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
    }
+   fOpenLastOffsets.resize(nColumns, 0);
 
    CreateImpl(model);
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RStatistics
+ROOT::Experimental::Detail::RPageSink::ComputeStatistics(ColumnHandle_t columnHandle, const RPage &page)
+{
+   RClusterDescriptor::RStatistics statistics;
+   const auto columnType = columnHandle.fColumn->GetModel().GetType();
+   if (columnType != EColumnType::kIndex && columnType != EColumnType::kDeltaIndex) {
+      statistics.fHasRange = columnHandle.fColumn->GetElement()->FindValueRange(page.GetBuffer(), page.GetNElements(),
+                                                                                statistics.fMin, statistics.fMax);
+      return statistics;
+   }
+
+   // Offsets count the collection elements from the beginning of the cluster; the statistics are about the
+   // collection sizes, i.e. the differences of consecutive offsets
+   auto offsets = reinterpret_cast<const ClusterSize_t *>(page.GetBuffer());
+   auto &lastOffset = fOpenLastOffsets[columnHandle.fId];
+   for (std::size_t i = 0; i < page.GetNElements(); ++i) {
+      const double size = offsets[i] - lastOffset;
+      lastOffset = offsets[i];
+      if (!statistics.fHasRange || size < statistics.fMin)
+         statistics.fMin = size;
+      if (!statistics.fHasRange || size > statistics.fMax)
+         statistics.fMax = size;
+      statistics.fHasRange = true;
+      if (size == 0)
+         statistics.fNNull++;
+   }
+   return statistics;
+}
+
+
+void ROOT::Experimental::Detail::RPageSink::AddPageInfo(DescriptorId_t columnId,
+                                                        const RClusterDescriptor::RPageRange::RPageInfo &pageInfo)
+{
+   auto &columnRange = fOpenColumnRanges[columnId];
+   auto &pageRange = fOpenPageRanges[columnId];
+   columnRange.fNElements += pageInfo.fNElements;
+   if (pageRange.fPageInfos.empty())
+      columnRange.fStatistics = pageInfo.fStatistics;
+   else
+      columnRange.fStatistics.Merge(pageInfo.fStatistics);
+   pageRange.fPageInfos.emplace_back(pageInfo);
+}
+
+
 void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHandle, const RPage &page)
 {
    auto locator = CommitPageImpl(columnHandle, page);
 
-   auto columnId = columnHandle.fId;
-   fOpenColumnRanges[columnId].fNElements += page.GetNElements();
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = locator;
-   fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+   if (fOptions.GetComputeStatistics())
+      pageInfo.fStatistics = ComputeStatistics(columnHandle, page);
+   AddPageInfo(columnHandle.fId, pageInfo);
+}
+
+
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage,
+                                                             const RClusterDescriptor::RStatistics &statistics)
+{
+   auto locator = CommitSealedPageImpl(columnId, sealedPage);
+
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fLocator = locator;
+   if (fOptions.GetComputeStatistics())
+      pageInfo.fStatistics = statistics;
+   AddPageInfo(columnId, pageInfo);
+}
+
+
+ROOT::Experimental::Detail::RPageSink::RSealedPage
+ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page, const RColumnElementBase &element,
+                                               int compressionSetting, void *buffer)
+{
+   unsigned char *pageBuf = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   bool isAdoptedBuffer = true;
+   auto packedBytes = page.GetSize();
+
+   if (!element.IsMappable()) {
+      packedBytes = (page.GetNElements() * element.GetBitsOnStorage() + 7) / 8;
+      pageBuf = new unsigned char[packedBytes];
+      isAdoptedBuffer = false;
+      element.Pack(pageBuf, page.GetBuffer(), page.GetNElements());
+   }
+   auto zippedBytes = RNTupleCompressor::Zip(pageBuf, packedBytes, compressionSetting, buffer);
+
+   if (!isAdoptedBuffer)
+      delete[] pageBuf;
+
+   RSealedPage result;
+   result.fBuffer = buffer;
+   result.fSize = zippedBytes;
+   result.fNElements = page.GetNElements();
+   return result;
 }
 
 
@@ -197,7 +332,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       fDescriptorBuilder.AddClusterColumnRange(fLastClusterId, range);
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
+      range.fStatistics = RClusterDescriptor::RStatistics();
    }
+   std::fill(fOpenLastOffsets.begin(), fOpenLastOffsets.end(), 0);
    for (auto &range : fOpenPageRanges) {
       RClusterDescriptor::RPageRange fullRange;
       std::swap(fullRange, range);
@@ -30,9 +30,12 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 
 #include <atomic>
@@ -46,7 +49,7 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
    , fMetrics("RPageSinkRoot")
-   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+   , fPageAllocator(std::make_unique<RPageAllocatorPool>())
 {
    R__LOG_WARNING(NTupleLog()) << "The RNTuple file format will change. " <<
       "Do not store real data with this version of RNTuple!";
@@ -60,7 +63,7 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
    const RNTupleWriteOptions &options)
    : RPageSink(ntupleName, options)
    , fMetrics("RPageSinkRoot")
-   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+   , fPageAllocator(std::make_unique<RPageAllocatorPool>())
 {
    R__LOG_WARNING(NTupleLog()) << "The RNTuple file format will change. " <<
       "Do not store real data with this version of RNTuple!";
@@ -73,7 +76,7 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
    const RNTupleWriteOptions &options, std::unique_ptr<TFile> &file)
    : RPageSink(ntupleName, options)
    , fMetrics("RPageSinkRoot")
-   , fPageAllocator(std::make_unique<RPageAllocatorHeap>())
+   , fPageAllocator(std::make_unique<RPageAllocatorPool>())
 {
    R__LOG_WARNING(NTupleLog()) << "The RNTuple file format will change. " <<
       "Do not store real data with this version of RNTuple!";
@@ -104,45 +107,135 @@ void ROOT::Experimental::Detail::RPageSinkFile::CreateImpl(const RNTupleModel &
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
 {
-   unsigned char *buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
-   bool isAdoptedBuffer = true;
-   auto packedBytes = page.GetSize();
    auto element = columnHandle.fColumn->GetElement();
    const auto isMappable = element->IsMappable();
+   const auto packedBytes =
+      isMappable ? page.GetSize() : (page.GetNElements() * element->GetBitsOnStorage() + 7) / 8;
+
+   // Keep the memory consumption of the sealed pages bounded; the page locators of the already sealed pages
+   // are all in fOpenPageRanges at this point
+   if (!fSealedPages.empty() && (fSealedPageBytes + packedBytes > fOptions.GetMaxSealedPageBytes()))
+      CommitSealedPages();
+
+   // The page buffer is reused by the column after CommitPage() returns, so the sealed page needs a copy
+   RPendingPage sealedPage;
+   sealedPage.fColumnId = columnHandle.fId;
+   sealedPage.fPageIndex = fOpenPageRanges[columnHandle.fId].fPageInfos.size();
+   sealedPage.fPackedBuffer = RPageAllocatorPool::MakeBuffer(packedBytes);
+   sealedPage.fPackedBytes = packedBytes;
+   if (isMappable && fOptions.GetAlignUncompressedPages())
+      sealedPage.fAlignment = element->GetSize();
+   if (isMappable)
+      memcpy(sealedPage.fPackedBuffer.get(), page.GetBuffer(), packedBytes);
+   else
+      element->Pack(sealedPage.fPackedBuffer.get(), page.GetBuffer(), page.GetNElements());
+   fSealedPages.emplace_back(std::move(sealedPage));
+   fSealedPageBytes += packedBytes;
+
+   // The locator is set by CommitSealedPages()
+   return RClusterDescriptor::RLocator();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t columnId,
+                                                               const RSealedPage &sealedPage)
+{
+   const auto columnType = fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId).GetModel().GetType();
+   const auto packedBytes = (sealedPage.fNElements * RColumnElementBase::GetBitsOnStorage(columnType) + 7) / 8;
+
+   if (!fSealedPages.empty() && (fSealedPageBytes + sealedPage.fSize > fOptions.GetMaxSealedPageBytes()))
+      CommitSealedPages();
+
+   // The page is already compressed; it is buffered like the pages from CommitPageImpl() so that it is written
+   // by the same vector write.  The buffer of the sealed page is owned by the caller and needs a copy.
+   RPendingPage pendingPage;
+   pendingPage.fColumnId = columnId;
+   pendingPage.fPageIndex = fOpenPageRanges[columnId].fPageInfos.size();
+   pendingPage.fPackedBytes = packedBytes;
+   if (fOptions.GetAlignUncompressedPages() && (RColumnElementBase::GetBitsOnStorage(columnType) % 8 == 0))
+      pendingPage.fAlignment = RColumnElementBase::GetBitsOnStorage(columnType) / 8;
+   pendingPage.fZipBuffer = RPageAllocatorPool::MakeBuffer(sealedPage.fSize);
+   pendingPage.fZippedBytes = sealedPage.fSize;
+   memcpy(pendingPage.fZipBuffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+   fSealedPages.emplace_back(std::move(pendingPage));
+   fSealedPageBytes += sealedPage.fSize;
+
+   // The locator is set by CommitSealedPages()
+   return RClusterDescriptor::RLocator();
+}
 
-   if (!isMappable) {
-      packedBytes = (page.GetNElements() * element->GetBitsOnStorage() + 7) / 8;
-      buffer = new unsigned char[packedBytes];
-      isAdoptedBuffer = false;
-      element->Pack(buffer, page.GetBuffer(), page.GetNElements());
+
+void ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPages()
+{
+   if (fSealedPages.empty())
+      return;
+
+   // Pages from CommitSealedPageImpl() arrive compressed, only the pages from CommitPageImpl() need to be zipped
+   const auto compression = fOptions.GetCompression();
+   if (compression != 0) {
+      auto fnZip = [compression](RPendingPage &sealedPage) {
+         sealedPage.fZipBuffer = RPageAllocatorPool::MakeBuffer(sealedPage.fPackedBytes);
+         sealedPage.fZippedBytes = RNTupleCompressor::Zip(sealedPage.fPackedBuffer.get(), sealedPage.fPackedBytes,
+                                                          compression, sealedPage.fZipBuffer.get());
+         sealedPage.fPackedBuffer.reset();
+      };
+      if (fTaskScheduler) {
+         fTaskScheduler->Reset();
+         for (auto &sealedPage : fSealedPages) {
+            if (!sealedPage.fZipBuffer)
+               fTaskScheduler->AddTask([&sealedPage, &fnZip]() { fnZip(sealedPage); });
+         }
+         fTaskScheduler->Wait();
+      } else {
+         for (auto &sealedPage : fSealedPages) {
+            if (!sealedPage.fZipBuffer)
+               fnZip(sealedPage);
+         }
+      }
    }
-   auto zippedBytes = packedBytes;
-
-   if (fOptions.GetCompression() != 0) {
-      zippedBytes = fCompressor(buffer, packedBytes, fOptions.GetCompression());
-      if (!isAdoptedBuffer)
-         delete[] buffer;
-      buffer = const_cast<unsigned char *>(reinterpret_cast<const unsigned char *>(fCompressor.GetZipBuffer()));
-      isAdoptedBuffer = true;
+
+   // Pages are written in the order of their commit by a single vector write, which results in the same on-disk
+   // layout as writing the pages one by one
+   std::vector<Internal::RNTupleFileWriter::RBlobRequest> requests;
+   requests.reserve(fSealedPages.size());
+   for (auto &sealedPage : fSealedPages) {
+      Internal::RNTupleFileWriter::RBlobRequest request;
+      if (sealedPage.fZipBuffer) {
+         request.fData = sealedPage.fZipBuffer.get();
+      } else {
+         request.fData = sealedPage.fPackedBuffer.get();
+         sealedPage.fZippedBytes = sealedPage.fPackedBytes;
+      }
+      request.fNBytes = sealedPage.fZippedBytes;
+      request.fLen = sealedPage.fPackedBytes;
+      if (sealedPage.fZippedBytes == sealedPage.fPackedBytes)
+         request.fAlignment = sealedPage.fAlignment;
+      requests.emplace_back(request);
    }
+   fWriter->WriteBlobV(requests);
 
-   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
-   fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
-   fClusterMaxOffset = std::max(offsetData + zippedBytes, fClusterMaxOffset);
+   for (std::size_t i = 0; i < fSealedPages.size(); ++i) {
+      const auto &sealedPage = fSealedPages[i];
+      const auto offsetData = requests[i].fOffset;
+      fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
+      fClusterMaxOffset = std::max(offsetData + sealedPage.fZippedBytes, fClusterMaxOffset);
 
-   if (!isAdoptedBuffer)
-      delete[] buffer;
+      auto &pageInfo = fOpenPageRanges[sealedPage.fColumnId].fPageInfos[sealedPage.fPageIndex];
+      pageInfo.fLocator.fPosition = offsetData;
+      pageInfo.fLocator.fBytesOnStorage = sealedPage.fZippedBytes;
+   }
 
-   RClusterDescriptor::RLocator result;
-   result.fPosition = offsetData;
-   result.fBytesOnStorage = zippedBytes;
-   return result;
+   fSealedPages.clear();
+   fSealedPageBytes = 0;
 }
 
 
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
+   CommitSealedPages();
+
    RClusterDescriptor::RLocator result;
    result.fPosition = fClusterMinOffset;
    result.fBytesOnStorage = fClusterMaxOffset - fClusterMinOffset;
@@ -197,7 +290,7 @@ void ROOT::Experimental::Detail::RPageAllocatorFile::DeletePage(const RPage& pag
 {
    if (page.IsNull())
       return;
-   delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
+   RPageAllocatorPool::Release(page.GetBuffer(), page.GetCapacity());
 }
 
 
@@ -210,8 +303,9 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    , fMetrics("RPageSourceFile")
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this))
+   , fClusterPool(std::make_unique<RClusterPool>(*this, options))
 {
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nReadV", "", "number of vector read requests"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nRead", "", "number of byte ranges read"),
@@ -222,6 +316,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
                                                    "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "",
+                                                   "number of populated pages served from the memory mapped file"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallRead", "ns", "wall clock time spent reading"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns", "wall clock time spent decompressing"),
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuRead", "ns", "CPU time spent reading"),
@@ -313,6 +409,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
 
 ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
 {
+   if (fMmapRegion)
+      fFile->Unmap(fMmapRegion, fMmapSize);
 }
 
 
@@ -333,10 +431,42 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
    fDecompressor(zipBuffer.get(), ntpl.fNBytesFooter, ntpl.fLenFooter, buffer.get());
    descBuilder.AddClustersFromFooter(buffer.get());
 
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap) && !fMmapRegion) {
+      // Without a mapping, all the pages are copied, which is slower but correct
+      try {
+         std::uint64_t mapdOffset;
+         auto size = fFile->GetSize();
+         fMmapRegion = reinterpret_cast<unsigned char *>(fFile->Map(size, 0, mapdOffset));
+         fMmapSize = size;
+         R__ASSERT(mapdOffset == 0);
+      } catch (const std::runtime_error &) {
+         fMmapRegion = nullptr;
+      }
+   }
+
    return descBuilder.MoveDescriptor();
 }
 
 
+void *ROOT::Experimental::Detail::RPageSourceFile::GetMappedPage(
+   const RClusterDescriptor::RPageRange::RPageInfo &pageInfo, const RColumnElementBase &element) const
+{
+   if (!fMmapRegion || !element.IsMappable())
+      return nullptr;
+   const auto &locator = pageInfo.fLocator;
+   // For mappable elements, the packed size equals the in-memory size; differing sizes indicate compression
+   if (locator.fBytesOnStorage != element.GetSize() * pageInfo.fNElements)
+      return nullptr;
+   if (locator.fPosition < 0 || static_cast<std::uint64_t>(locator.fPosition) + locator.fBytesOnStorage > fMmapSize)
+      return nullptr;
+   auto address = fMmapRegion + locator.fPosition;
+   // The pages are not aligned in the file; the in-memory type may only be accessed at suitable addresses
+   if (reinterpret_cast<std::uintptr_t>(address) % element.GetSize() != 0)
+      return nullptr;
+   return address;
+}
+
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(
    ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor, ClusterSize_t::ValueType idxInCluster)
 {
@@ -344,20 +474,9 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto clusterId = clusterDescriptor.GetId();
    const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
 
-   // TODO(jblomer): binary search
-   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
-   decltype(idxInCluster) firstInPage = 0;
-   NTupleSize_t pageNo = 0;
-   for (const auto &pi : pageRange.fPageInfos) {
-      if (firstInPage + pi.fNElements > idxInCluster) {
-         pageInfo = pi;
-         break;
-      }
-      firstInPage += pi.fNElements;
-      ++pageNo;
-   }
-   R__ASSERT(firstInPage <= idxInCluster);
-   R__ASSERT((firstInPage + pageInfo.fNElements) > idxInCluster);
+   const auto pageInfo = pageRange.Find(idxInCluster);
+   const auto firstInPage = pageInfo.fFirstInPage;
+   const auto pageNo = pageInfo.fPageNo;
 
    const auto element = columnHandle.fColumn->GetElement();
    const auto elementSize = element->GetSize();
@@ -365,9 +484,21 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    const auto bytesPacked = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
    const auto pageSize = elementSize * pageInfo.fNElements;
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
 
-   auto pageBuffer = new unsigned char[bytesPacked];
+   if (auto mappedPage = GetMappedPage(pageInfo, *element)) {
+      // The mapping stays valid as long as the page source is alive, so there is nothing to free
+      auto newPage = fPageAllocator->NewPage(columnId, mappedPage, elementSize, pageInfo.fNElements);
+      newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+      fPagePool->RegisterPage(newPage, RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}, nullptr));
+      fCounters->fNPagePopulated.Inc();
+      fCounters->fNPageMapped.Inc();
+      return newPage;
+   }
+
+   unsigned char *pageBuffer = nullptr;
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+      pageBuffer = RPageAllocatorPool::Allocate(bytesPacked);
       fReader.ReadBuffer(pageBuffer, bytesOnStorage, pageInfo.fLocator.fPosition);
       fCounters->fNPageLoaded.Inc();
    } else {
@@ -380,12 +511,21 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
       if (!cachedPage.IsNull())
          return cachedPage;
 
+      // Allocate only on a cache miss; the pages preloaded by the unzip tasks are returned above
+      pageBuffer = RPageAllocatorPool::Allocate(bytesPacked);
       ROnDiskPage::Key key(columnId, pageNo);
       //printf("POPULATE cluster %ld column %ld page %ld\n", clusterId, columnId, pageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
-      R__ASSERT(onDiskPage);
-      R__ASSERT(bytesOnStorage == onDiskPage->GetSize());
-      memcpy(pageBuffer, onDiskPage->GetAddress(), onDiskPage->GetSize());
+      if (onDiskPage) {
+         R__ASSERT(bytesOnStorage == onDiskPage->GetSize());
+         memcpy(pageBuffer, onDiskPage->GetAddress(), onDiskPage->GetSize());
+      } else {
+         // The cluster did not load the page because it was expected to be served from the memory mapped file
+         // but the in-memory type of the column changed in the meantime
+         R__ASSERT(fMmapRegion);
+         fReader.ReadBuffer(pageBuffer, bytesOnStorage, pageInfo.fLocator.fPosition);
+         fCounters->fNPageLoaded.Inc();
+      }
    }
 
    if (bytesOnStorage != bytesPacked) {
@@ -395,13 +535,12 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    }
 
    if (!element->IsMappable()) {
-      auto unpackedBuffer = new unsigned char[pageSize];
+      auto unpackedBuffer = RPageAllocatorPool::Allocate(pageSize);
       element->Unpack(unpackedBuffer, pageBuffer, pageInfo.fNElements);
-      delete[] pageBuffer;
+      RPageAllocatorPool::Release(pageBuffer, bytesPacked);
       pageBuffer = unpackedBuffer;
    }
 
-   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
    auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
    newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
    fPagePool->RegisterPage(newPage,
@@ -446,6 +585,25 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    return PopulatePageFromCluster(columnHandle, clusterDescriptor, idxInCluster);
 }
 
+void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t columnId,
+                                                                 const RClusterIndex &clusterIndex,
+                                                                 RSealedPage &sealedPage)
+{
+   const auto clusterId = clusterIndex.GetClusterId();
+   const auto idxInCluster = clusterIndex.GetIndex();
+   R__ASSERT(clusterId != kInvalidDescriptorId);
+   const auto &pageRange = fDescriptor.GetClusterDescriptor(clusterId).GetPageRange(columnId);
+
+   const auto pageInfo = pageRange.Find(idxInCluster);
+
+   sealedPage.fSize = pageInfo.fLocator.fBytesOnStorage;
+   sealedPage.fNElements = pageInfo.fNElements;
+   if (sealedPage.fBuffer) {
+      fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), sealedPage.fSize, pageInfo.fLocator.fPosition);
+      fCounters->fNPageLoaded.Inc();
+   }
+}
+
 void ROOT::Experimental::Detail::RPageSourceFile::ReleasePage(RPage &page)
 {
    fPagePool->ReturnPage(page);
@@ -460,10 +618,12 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
-ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
+   const RCluster::RKey &clusterKey,
+   std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
 {
-   fCounters->fNClusterLoaded.Inc();
-
+   const auto clusterId = clusterKey.fClusterId;
+   const auto &columns = clusterKey.fColumnSet;
    const auto &clusterDesc = GetDescriptor().GetClusterDescriptor(clusterId);
    auto clusterLocator = clusterDesc.GetLocator();
    auto clusterSize = clusterLocator.fBytesOnStorage;
@@ -485,8 +645,16 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    auto activeSize = 0;
    for (auto columnId : columns) {
       const auto &pageRange = clusterDesc.GetPageRange(columnId);
+      // Pages that are served from the memory mapped file do not need to be read
+      std::shared_ptr<RColumnElementBase> element;
+      if (fMmapRegion)
+         element = GetActiveElement(columnId);
       NTupleSize_t pageNo = 0;
       for (const auto &pageInfo : pageRange.fPageInfos) {
+         if (element && GetMappedPage(pageInfo, *element)) {
+            ++pageNo;
+            continue;
+         }
          const auto &pageLocator = pageInfo.fLocator;
          activeSize += pageLocator.fBytesOnStorage;
          onDiskPages.emplace_back(ROnDiskPageLocator(
@@ -521,16 +689,9 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       gapCut = g;
    }
 
-   // Prepare the input vector for the RRawFile::ReadV() call
-   struct RReadRequest {
-      RReadRequest() = default;
-      RReadRequest(std::size_t b, std::uint64_t o, std::uint64_t s) : fBufPos(b), fOffset(o), fSize(s) {}
-      std::size_t fBufPos = 0;
-      std::uint64_t fOffset = 0;
-      std::uint64_t fSize = 0;
-   };
-   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
-
+   // Prepare the input vector for the RRawFile::ReadV() call; the buffer addresses are first relative to the
+   // start of the cluster buffer and get fixed up once the buffer is allocated
+   const auto firstRequest = readRequests.size();
    ROOT::Internal::RRawFile::RIOVec req;
    std::size_t szPayload = 0;
    std::size_t szOverhead = 0;
@@ -557,23 +718,57 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       req.fOffset = s.fOffset;
       req.fSize = s.fSize;
    }
-   readRequests.emplace_back(req);
+   if (req.fSize > 0)
+      readRequests.emplace_back(req);
    fCounters->fSzReadPayload.Add(szPayload);
    fCounters->fSzReadOverhead.Add(szOverhead);
 
    // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+   const std::size_t bufferSize = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize;
+   auto buffer = RPageAllocatorPool::Allocate(bufferSize);
+   auto pageMap = std::make_unique<ROnDiskPageMapPool>(buffer, bufferSize);
    for (const auto &s : onDiskPages) {
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
-   for (auto &r : readRequests) {
-      r.fBuffer = buffer + reinterpret_cast<intptr_t>(r.fBuffer);
+   for (auto i = firstRequest; i < readRequests.size(); ++i) {
+      readRequests[i].fBuffer = buffer + reinterpret_cast<intptr_t>(readRequests[i].fBuffer);
+   }
+
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : columns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   std::vector<RCluster::RKey> clusterKeys{RCluster::RKey{clusterId, columns}};
+   return std::move(LoadClusters(clusterKeys)[0]);
+}
+
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(const std::vector<RCluster::RKey> &clusterKeys)
+{
+   fCounters->fNClusterLoaded.Add(clusterKeys.size());
+
+   // The coalesced read requests of all the clusters are issued as a single vector read.  For local files on Linux,
+   // RRawFileUnix submits such a vector read as one batch of io_uring read events, if io_uring is available.
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   for (const auto &key : clusterKeys) {
+      clusters.emplace_back(PrepareSingleCluster(key, readRequests));
    }
 
    auto nReqs = readRequests.size();
+   if (nReqs == 0)
+      return clusters;
+
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
       fFile->ReadV(&readRequests[0], nReqs);
@@ -581,63 +776,79 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
-   auto cluster = std::make_unique<RCluster>(clusterId);
-   cluster->Adopt(std::move(pageMap));
-   for (auto colId : columns)
-      cluster->SetColumnAvailable(colId);
-   return cluster;
+   return clusters;
 }
 
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
-   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-   fTaskScheduler->Reset();
-
    const auto clusterId = cluster->GetId();
    const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
-
-   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   // The tasks keep the memory of the on-disk pages alive even if the cluster is meanwhile evicted from the pool
+   const auto &pageMaps = cluster->GetPageMaps();
 
    const auto &columnsInCluster = cluster->GetAvailColumns();
    for (const auto columnId : columnsInCluster) {
-      const auto &columnDesc = fDescriptor.GetColumnDescriptor(columnId);
-
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      auto element = GetActiveElement(columnId);
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
-         R__ASSERT(onDiskPage);
+         if (!onDiskPage) {
+            // Served from the memory mapped file by PopulatePage()
+            R__ASSERT(fMmapRegion);
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
          R__ASSERT(onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage);
 
+         // Requests for the page block until the task below has preloaded it
+         fPagePool->AnnouncePage(columnId, indexOffset + firstInPage, pi.fNElements,
+                                 RPage::RClusterInfo(clusterId, indexOffset));
+
          auto taskFunc =
-            [this, columnId, clusterId, firstInPage, onDiskPage,
-             element = allElements.back().get(),
-             nElements = pi.fNElements,
-             indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
+            [this, columnId, clusterId, firstInPage, onDiskPage, pageMaps, element, indexOffset,
+             nElements = pi.fNElements
             ] () {
+               RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
                const auto bytesPacked = (element->GetBitsOnStorage() * nElements + 7) / 8;
                const auto pageSize = element->GetSize() * nElements;
 
-               auto pageBufferPacked = new unsigned char[bytesPacked];
-               if (onDiskPage->GetSize() != bytesPacked) {
-                  fDecompressor(onDiskPage->GetAddress(), onDiskPage->GetSize(), bytesPacked, pageBufferPacked);
-                  fCounters->fSzUnzip.Add(bytesPacked);
-               } else {
-                  // We cannot simply map the onDiskPage because the cluster pool and the page pool have different
-                  // life times
-                  memcpy(pageBufferPacked, onDiskPage->GetAddress(), bytesPacked);
-               }
+               unsigned char *pageBufferPacked = nullptr;
+               unsigned char *pageBuffer = nullptr;
+               try {
+                  pageBufferPacked = RPageAllocatorPool::Allocate(bytesPacked);
+                  if (onDiskPage->GetSize() != bytesPacked) {
+                     fDecompressor(onDiskPage->GetAddress(), onDiskPage->GetSize(), bytesPacked, pageBufferPacked);
+                     fCounters->fSzUnzip.Add(bytesPacked);
+                  } else {
+                     // We cannot simply map the onDiskPage because the cluster pool and the page pool have
+                     // different life times
+                     memcpy(pageBufferPacked, onDiskPage->GetAddress(), bytesPacked);
+                  }
 
-               auto pageBuffer = pageBufferPacked;
-               if (!element->IsMappable()) {
-                  pageBuffer = new unsigned char[pageSize];
-                  element->Unpack(pageBuffer, pageBufferPacked, nElements);
-                  delete[] pageBufferPacked;
+                  if (element->IsMappable()) {
+                     std::swap(pageBuffer, pageBufferPacked);
+                  } else {
+                     pageBuffer = RPageAllocatorPool::Allocate(pageSize);
+                     element->Unpack(pageBuffer, pageBufferPacked, nElements);
+                     RPageAllocatorPool::Release(pageBufferPacked, bytesPacked);
+                     pageBufferPacked = nullptr;
+                  }
+               } catch (...) {
+                  if (pageBufferPacked)
+                     RPageAllocatorPool::Release(pageBufferPacked, bytesPacked);
+                  if (pageBuffer)
+                     RPageAllocatorPool::Release(pageBuffer, pageSize);
+                  // Readers waiting for the page fall back to populating it themselves from the cluster, which
+                  // reports the error to the caller instead of blocking it forever
+                  fPagePool->DiscardPendingPage(columnId, indexOffset + firstInPage);
+                  return;
                }
 
                auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, element->GetSize(), nElements);
@@ -657,6 +868,4 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    } // for all columns in cluster
 
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
-
-   fTaskScheduler->Wait();
 }
@@ -213,6 +213,120 @@ TEST(RNTuple, Clusters)
 }
 
 
+TEST(RNTuple, Statistics)
+{
+   FileRaii fileGuard("test_ntuple_statistics.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+   auto wrN = modelWrite->MakeField<std::int32_t>("n");
+   auto wrJets = modelWrite->MakeField<std::vector<float>>("jets");
+
+   {
+      RNTupleWriter ntuple(std::move(modelWrite),
+         std::make_unique<RPageSinkFile>("myNTuple", fileGuard.GetPath(), RNTupleWriteOptions()));
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = 1.0 + i;
+         *wrN = -i;
+         wrJets->resize(i);
+         ntuple.Fill();
+      }
+      ntuple.CommitCluster();
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = 10.0 + i;
+         *wrN = i;
+         wrJets->resize(2);
+         ntuple.Fill();
+      }
+      ntuple.CommitCluster();
+      *wrPt = std::numeric_limits<float>::quiet_NaN();
+      ntuple.Fill();
+   }
+
+   RPageSourceFile source("myNTuple", fileGuard.GetPath(), RNTupleReadOptions());
+   source.Attach();
+   const auto &desc = source.GetDescriptor();
+   ASSERT_EQ(3U, desc.GetNClusters());
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto nColumnId = desc.FindColumnId(desc.FindFieldId("n"), 0);
+   const auto jetsColumnId = desc.FindColumnId(desc.FindFieldId("jets"), 0);
+
+   const auto &ptStats = desc.GetClusterDescriptor(1).GetColumnRange(ptColumnId).fStatistics;
+   EXPECT_TRUE(ptStats.fHasRange);
+   EXPECT_EQ(10.0, ptStats.fMin);
+   EXPECT_EQ(12.0, ptStats.fMax);
+   const auto &ptPageStats = desc.GetClusterDescriptor(1).GetPageRange(ptColumnId).fPageInfos[0].fStatistics;
+   EXPECT_EQ(ptStats, ptPageStats);
+   // A page of NaN values has no range and cannot be skipped
+   EXPECT_FALSE(desc.GetClusterDescriptor(2).GetColumnRange(ptColumnId).fStatistics.fHasRange);
+
+   const auto &nStats = desc.GetClusterDescriptor(0).GetColumnRange(nColumnId).fStatistics;
+   EXPECT_EQ(-2.0, nStats.fMin);
+   EXPECT_EQ(0.0, nStats.fMax);
+
+   // For collections, the statistics are about the collection sizes
+   const auto &jetsStats = desc.GetClusterDescriptor(0).GetColumnRange(jetsColumnId).fStatistics;
+   EXPECT_EQ(0.0, jetsStats.fMin);
+   EXPECT_EQ(2.0, jetsStats.fMax);
+   EXPECT_EQ(1U, jetsStats.fNNull);
+   EXPECT_EQ(0U, desc.GetClusterDescriptor(1).GetColumnRange(jetsColumnId).fStatistics.fNNull);
+
+   EXPECT_EQ(std::vector<DescriptorId_t>({1, 2}), desc.FindClustersInRange(ptColumnId, 5.0, 10.5));
+   EXPECT_EQ(std::vector<DescriptorId_t>({0, 1, 2}), desc.FindClustersInRange(ptColumnId, 0.0, 100.0));
+   auto ranges = desc.FindElementRangesInRange(ptColumnId, 0.0, 2.5);
+   ASSERT_EQ(2U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(3U, ranges[0].second);
+   EXPECT_EQ(6U, ranges[1].first);
+   EXPECT_EQ(7U, ranges[1].second);
+   ranges = desc.FindElementRangesInRange(jetsColumnId, 2.0, 2.0);
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(7U, ranges[0].second);
+   EXPECT_TRUE(desc.HasStatistics());
+}
+
+TEST(RNTuple, NoStatistics)
+{
+   FileRaii fileGuard("test_ntuple_no_statistics.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+   auto wrJets = modelWrite->MakeField<std::vector<float>>("jets");
+
+   {
+      RNTupleWriteOptions options;
+      options.SetComputeStatistics(false);
+      RNTupleWriter ntuple(std::move(modelWrite),
+         std::make_unique<RPageSinkFile>("myNTuple", fileGuard.GetPath(), options));
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = 1.0 + i;
+         wrJets->resize(i);
+         ntuple.Fill();
+      }
+   }
+
+   RPageSourceFile source("myNTuple", fileGuard.GetPath(), RNTupleReadOptions());
+   source.Attach();
+   const auto &desc = source.GetDescriptor();
+   EXPECT_FALSE(desc.HasStatistics());
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto &ptStats = desc.GetClusterDescriptor(0).GetColumnRange(ptColumnId).fStatistics;
+   EXPECT_FALSE(ptStats.fHasRange);
+   EXPECT_FALSE(desc.GetClusterDescriptor(0).GetPageRange(ptColumnId).fPageInfos[0].fStatistics.fHasRange);
+   // Without statistics, no cluster can be skipped
+   EXPECT_EQ(std::vector<DescriptorId_t>({0}), desc.FindClustersInRange(ptColumnId, 100.0, 200.0));
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(3U, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewJets = ntuple->GetView<std::vector<float>>("jets");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(1.0 + i, viewPt(i));
+      EXPECT_EQ(i, viewJets(i).size());
+   }
+}
+
 TEST(RNTupleModel, EnforceValidFieldNames)
 {
    auto model = RNTupleModel::Create();
@@ -14,6 +14,7 @@
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -63,11 +64,25 @@ public:
       descBuilder.AddCluster(2, RNTupleVersion(), 2, ClusterSize_t(1));
       descBuilder.AddCluster(3, RNTupleVersion(), 3, ClusterSize_t(1));
       descBuilder.AddCluster(4, RNTupleVersion(), 4, ClusterSize_t(1));
+      // Every cluster has a single page of 100 bytes in the columns 0 and 1
+      for (ROOT::Experimental::DescriptorId_t clusterId = 0; clusterId < 5; ++clusterId) {
+         for (ROOT::Experimental::DescriptorId_t columnId = 0; columnId < 2; ++columnId) {
+            ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+            pageRange.fColumnId = columnId;
+            ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+            pageInfo.fNElements = 1;
+            pageInfo.fLocator.fBytesOnStorage = 100;
+            pageRange.fPageInfos.emplace_back(pageInfo);
+            descBuilder.AddClusterPageRange(clusterId, std::move(pageRange));
+         }
+      }
       fDescriptor = descBuilder.MoveDescriptor();
    }
    std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
    RPage PopulatePage(ColumnHandle_t, ROOT::Experimental::NTupleSize_t) final { return RPage(); }
    RPage PopulatePage(ColumnHandle_t, const ROOT::Experimental::RClusterIndex &) final { return RPage(); }
+   void LoadSealedPage(ROOT::Experimental::DescriptorId_t, const ROOT::Experimental::RClusterIndex &,
+                       RSealedPage &) final {}
    void ReleasePage(RPage &) final {}
    std::unique_ptr<RCluster> LoadCluster(
       ROOT::Experimental::DescriptorId_t clusterId,
@@ -269,6 +284,79 @@ TEST(ClusterPool, GetClusterBasics)
 }
 
 
+TEST(ClusterPool, ReadOptions)
+{
+   RPageSourceMock p1;
+   {
+      ROOT::Experimental::RNTupleReadOptions options;
+      options.SetClusterReadAhead(3);
+      RClusterPool c1(p1, options);
+      EXPECT_EQ(1U, c1.GetWindowPre());
+      EXPECT_EQ(4U, c1.GetWindowPost());
+      c1.GetCluster(0, {0});
+   }
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(3U, p1.fReqsClusterIds[3]);
+
+   // Only the active cluster fits in the memory limit
+   RPageSourceMock p2;
+   {
+      ROOT::Experimental::RNTupleReadOptions options;
+      options.SetClusterReadAhead(3);
+      options.SetClusterPoolMaxBytes(250);
+      RClusterPool c2(p2, options);
+      c2.GetCluster(1, {0, 1});
+   }
+   ASSERT_EQ(1U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p2.fReqsClusterIds[0]);
+
+   // The active cluster is loaded even if it exceeds the memory limit
+   RPageSourceMock p3;
+   {
+      ROOT::Experimental::RNTupleReadOptions options;
+      options.SetClusterPoolMaxBytes(50);
+      RClusterPool c3(p3, options);
+      c3.GetCluster(2, {0});
+   }
+   ASSERT_EQ(1U, p3.fReqsClusterIds.size());
+   EXPECT_EQ(2U, p3.fReqsClusterIds[0]);
+}
+
+
+TEST(ClusterPool, EvictionPolicy)
+{
+   /// Always retains the first cluster
+   class RKeepFirstPolicy : public ROOT::Experimental::Detail::RClusterEvictionPolicy {
+   public:
+      std::vector<ROOT::Experimental::DescriptorId_t>
+      GetRetainedClusters(ROOT::Experimental::DescriptorId_t, const RNTupleDescriptor &) const final
+      {
+         return {0};
+      }
+   };
+
+   RPageSourceMock p1;
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetClusterReadAhead(0);
+   options.SetClusterEvictionPolicy(std::make_shared<RKeepFirstPolicy>());
+   RClusterPool c1(p1, options);
+   EXPECT_EQ(0U, c1.GetWindowPre());
+   EXPECT_EQ(1U, c1.GetWindowPost());
+   c1.GetCluster(0, {0});
+   c1.GetCluster(2, {0});
+   c1.GetCluster(0, {0});
+   // The first cluster stayed in the pool
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(2U, p1.fReqsClusterIds[1]);
+   c1.GetCluster(1, {0});
+   c1.GetCluster(2, {0});
+   // Without look-back, cluster 2 has been evicted in the meantime
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(2U, p1.fReqsClusterIds[3]);
+}
+
+
 TEST(ClusterPool, GetClusterIncrementally)
 {
    RPageSourceMock p1;
@@ -328,3 +416,133 @@ TEST(PageStorageFile, LoadCluster)
    ROnDiskPage::Key key(colId, 0);
    EXPECT_NE(nullptr, cluster->GetOnDiskPage(key));
 }
+
+
+TEST(PageStorageFile, LoadClusters)
+{
+   FileRaii fileGuard("test_ntuple_load_clusters.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+   auto wrTag = modelWrite->MakeField<int32_t>("tag", 0);
+
+   {
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite), std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(
+            "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleWriteOptions()));
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = i;
+         *wrTag = i;
+         ntuple.Fill();
+         ntuple.CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::Detail::RPageSourceFile source(
+      "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions());
+   source.Attach();
+   source.GetMetrics().Enable();
+
+   auto ptId = source.GetDescriptor().FindFieldId("pt");
+   auto tagId = source.GetDescriptor().FindFieldId("tag");
+   auto ptColId = source.GetDescriptor().FindColumnId(ptId, 0);
+   auto tagColId = source.GetDescriptor().FindColumnId(tagId, 0);
+
+   std::vector<RCluster::RKey> clusterKeys;
+   clusterKeys.push_back(RCluster::RKey{2, {ptColId}});
+   clusterKeys.push_back(RCluster::RKey{0, {ptColId, tagColId}});
+   clusterKeys.push_back(RCluster::RKey{1, {}});
+   auto clusters = source.LoadClusters(clusterKeys);
+   ASSERT_EQ(3U, clusters.size());
+   EXPECT_EQ(2U, clusters[0]->GetId());
+   EXPECT_EQ(1U, clusters[0]->GetNOnDiskPages());
+   EXPECT_EQ(0U, clusters[1]->GetId());
+   EXPECT_EQ(2U, clusters[1]->GetNOnDiskPages());
+   EXPECT_EQ(1U, clusters[2]->GetId());
+   EXPECT_EQ(0U, clusters[2]->GetNOnDiskPages());
+
+   auto onDiskPage = clusters[0]->GetOnDiskPage(ROnDiskPage::Key(ptColId, 0));
+   ASSERT_NE(nullptr, onDiskPage);
+   ASSERT_EQ(sizeof(float), onDiskPage->GetSize());
+   float pt;
+   memcpy(&pt, onDiskPage->GetAddress(), sizeof(float));
+   EXPECT_EQ(2.0, pt);
+
+   // All the pages of all the clusters are read by a single vector read
+   EXPECT_EQ(1, source.GetMetrics().GetCounter("RPageSourceFile.nReadV")->GetValueAsInt());
+   EXPECT_EQ(3, source.GetMetrics().GetCounter("RPageSourceFile.nClusterLoaded")->GetValueAsInt());
+}
+
+TEST(PageStorageFile, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrByte = modelWrite->MakeField<std::uint8_t>("byte", 0);
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+   {
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetAlignUncompressedPages(true);
+      auto ntuple = ROOT::Experimental::RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple",
+                                                                fileGuard.GetPath(), options);
+      for (int i = 0; i < 3; ++i) {
+         *wrByte = i;
+         *wrPt = i;
+         ntuple->Fill();
+         ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetUseMmap(true);
+   auto ntuple = ROOT::Experimental::RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto rdByte = ntuple->GetModel()->GetDefaultEntry()->Get<std::uint8_t>("byte");
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   for (unsigned i = 0; i < 3; ++i) {
+      ntuple->LoadEntry(i);
+      EXPECT_EQ(i, *rdByte);
+      EXPECT_EQ(float(i), *rdPt);
+   }
+
+   // With aligned pages, the byte and the float pages of all three clusters are mapped
+   EXPECT_EQ(6, ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped")->GetValueAsInt());
+}
+
+TEST(ClusterPool, Metrics)
+{
+   FileRaii fileGuard("test_ntuple_clusterpool_metrics.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+   {
+      auto ntuple = ROOT::Experimental::RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple",
+                                                                fileGuard.GetPath());
+      for (int i = 0; i < 3; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = ROOT::Experimental::RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   ntuple->EnableMetrics();
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   for (unsigned i = 0; i < 3; ++i) {
+      ntuple->LoadEntry(i);
+      EXPECT_EQ(float(i), *rdPt);
+   }
+
+   // The cluster pool counters are nested in the page source counters
+   const auto &metrics = ntuple->GetMetrics();
+   auto ctrRequested = metrics.GetCounter("RNTupleReader.RPageSourceFile.RClusterPool.nClusterRequested");
+   ASSERT_NE(nullptr, ctrRequested);
+   EXPECT_EQ(3, ctrRequested->GetValueAsInt());
+   EXPECT_GE(metrics.GetCounter("RNTupleReader.RPageSourceFile.RClusterPool.nClusterScheduled")->GetValueAsInt(), 3);
+
+   std::ostringstream prometheus;
+   metrics.PrintPrometheus(prometheus);
+   EXPECT_NE(std::string::npos,
+             prometheus.str().find("\nRNTupleReader_RPageSourceFile_RClusterPool_nClusterRequested 3\n"));
+}
@@ -108,6 +108,15 @@ TEST(RNTuple, Descriptor)
    EXPECT_EQ(0U, reference.FindPrevClusterId(1));
    EXPECT_EQ(ROOT::Experimental::kInvalidDescriptorId, reference.FindPrevClusterId(0));
 
+   const auto &pageRangeFound = reference.GetClusterDescriptor(0).GetPageRange(3);
+   EXPECT_EQ(0U, pageRangeFound.Find(0).fPageNo);
+   EXPECT_EQ(0U, pageRangeFound.Find(39).fPageNo);
+   auto pageInfoFound = pageRangeFound.Find(40);
+   EXPECT_EQ(1U, pageInfoFound.fPageNo);
+   EXPECT_EQ(40U, pageInfoFound.fFirstInPage);
+   EXPECT_EQ(1024U, pageInfoFound.fLocator.fPosition);
+   EXPECT_EQ(1U, pageRangeFound.Find(99).fPageNo);
+
    auto szHeader = reference.GetHeaderSize();
    auto headerBuffer = new unsigned char[szHeader];
    reference.SerializeHeader(headerBuffer);
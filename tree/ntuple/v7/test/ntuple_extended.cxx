@@ -107,6 +107,74 @@ TEST(RNTuple, RandomAccess)
 }
 
 
+
+TEST(RNTuple, ParallelZip)
+{
+   ROOT::EnableImplicitMT();
+   FileRaii fileGuardSerial("test_ntuple_parallel_zip_serial.root");
+   FileRaii fileGuardParallel("test_ntuple_parallel_zip.root");
+
+   constexpr unsigned int nEvents = 100000;
+   auto fnWrite = [](const std::string &path, bool useParallelZip) {
+      auto model = RNTupleModel::Create();
+      auto wrEnergy = model->MakeField<double>("energy");
+      auto wrHits = model->MakeField<std::vector<float>>("hits");
+      auto wrSignal = model->MakeField<bool>("signal");
+
+      RNTupleWriteOptions options;
+      options.SetUseParallelZip(useParallelZip);
+      // Force several rounds of compression tasks per cluster
+      options.SetMaxSealedPageBytes(64 * 1024);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", path, options);
+      TRandom3 rnd(42);
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrEnergy = rnd.Rndm();
+         wrHits->resize(i % 7);
+         for (auto &h : *wrHits)
+            h = rnd.Rndm();
+         *wrSignal = i % 3;
+         ntuple->Fill();
+      }
+   };
+   fnWrite(fileGuardSerial.GetPath(), false);
+   fnWrite(fileGuardParallel.GetPath(), true);
+
+   auto ntupleSerial = RNTupleReader::Open("myNTuple", fileGuardSerial.GetPath());
+   auto ntupleParallel = RNTupleReader::Open("myNTuple", fileGuardParallel.GetPath());
+   ASSERT_EQ(nEvents, ntupleParallel->GetNEntries());
+   EXPECT_EQ(ntupleSerial->GetDescriptor().GetNClusters(), ntupleParallel->GetDescriptor().GetNClusters());
+
+   // Pages are written in commit order, so the page locators of both files are identical
+   const auto &descSerial = ntupleSerial->GetDescriptor();
+   const auto &descParallel = ntupleParallel->GetDescriptor();
+   for (std::uint64_t i = 0; i < descSerial.GetNClusters(); ++i) {
+      const auto &clusterSerial = descSerial.GetClusterDescriptor(i);
+      const auto &clusterParallel = descParallel.GetClusterDescriptor(i);
+      EXPECT_EQ(clusterSerial.GetLocator().fBytesOnStorage, clusterParallel.GetLocator().fBytesOnStorage);
+      for (std::uint64_t c = 0; c < descSerial.GetNColumns(); ++c) {
+         const auto &pagesSerial = clusterSerial.GetPageRange(c).fPageInfos;
+         const auto &pagesParallel = clusterParallel.GetPageRange(c).fPageInfos;
+         ASSERT_EQ(pagesSerial.size(), pagesParallel.size());
+         for (std::size_t p = 0; p < pagesSerial.size(); ++p) {
+            EXPECT_EQ(pagesSerial[p].fNElements, pagesParallel[p].fNElements);
+            EXPECT_EQ(pagesSerial[p].fLocator.fBytesOnStorage, pagesParallel[p].fLocator.fBytesOnStorage);
+         }
+      }
+   }
+
+   auto viewEnergySerial = ntupleSerial->GetView<double>("energy");
+   auto viewEnergyParallel = ntupleParallel->GetView<double>("energy");
+   auto viewHitsSerial = ntupleSerial->GetView<std::vector<float>>("hits");
+   auto viewHitsParallel = ntupleParallel->GetView<std::vector<float>>("hits");
+   auto viewSignalSerial = ntupleSerial->GetView<bool>("signal");
+   auto viewSignalParallel = ntupleParallel->GetView<bool>("signal");
+   for (auto i : ntupleParallel->GetEntryRange()) {
+      EXPECT_EQ(viewEnergySerial(i), viewEnergyParallel(i));
+      EXPECT_EQ(viewHitsSerial(i), viewHitsParallel(i));
+      EXPECT_EQ(viewSignalSerial(i), viewSignalParallel(i));
+   }
+}
+
 #if !defined(_MSC_VER) || defined(R__ENABLE_BROKEN_WIN_TESTS)
 TEST(RNTuple, LargeFile)
 {
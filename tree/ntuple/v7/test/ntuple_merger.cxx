@@ -5,3 +5,111 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+void WriteMergeInput(const std::string &path, float offset, int compression)
+{
+   auto model = RNTupleModel::Create();
+   auto fldPt = RFieldBase::Create("pt", "float").Unwrap();
+   fldPt->SetColumnType(EColumnType::kSplitReal32);
+   model->AddField(std::move(fldPt));
+   auto wrVec = model->MakeField<std::vector<std::int32_t>>("vec");
+   auto wrPt = model->GetDefaultEntry()->Get<float>("pt");
+
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path, options);
+   for (int i = 0; i < 100; ++i) {
+      *wrPt = offset + i;
+      wrVec->assign(i % 3, i);
+      ntuple->Fill();
+      if (i % 40 == 39)
+         ntuple->CommitCluster();
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleMerger, MergeClusters)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+   FileRaii fileGuard4("test_ntuple_merge_out_recompressed.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0.0, 404);
+   WriteMergeInput(fileGuard2.GetPath(), 1000.0, 404);
+
+   for (int compression : {404, 0}) {
+      const auto &outPath = (compression == 404) ? fileGuard3.GetPath() : fileGuard4.GetPath();
+      {
+         auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+         auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+         RNTupleWriteOptions options;
+         options.SetCompression(compression);
+         auto destination = RPageSink::Create("ntuple", outPath, options);
+         RNTupleMerger merger;
+         merger.Merge({source1.get(), source2.get()}, *destination);
+      }
+
+      auto ntuple = RNTupleReader::Open("ntuple", outPath);
+      EXPECT_EQ(200U, ntuple->GetNEntries());
+      EXPECT_EQ(6U, ntuple->GetDescriptor().GetNClusters());
+      auto ptColumnId = ntuple->GetDescriptor().FindColumnId(ntuple->GetDescriptor().FindFieldId("pt"), 0);
+      EXPECT_EQ(EColumnType::kSplitReal32, ntuple->GetDescriptor().GetColumnDescriptor(ptColumnId).GetModel().GetType());
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewVec = ntuple->GetView<std::vector<std::int32_t>>("vec");
+      for (auto i : ntuple->GetEntryRange()) {
+         const int k = i % 100;
+         EXPECT_FLOAT_EQ((i < 100 ? 0.0 : 1000.0) + k, viewPt(i));
+         EXPECT_EQ(std::vector<std::int32_t>(k % 3, k), viewVec(i));
+      }
+   }
+}
+
+TEST(RNTupleMerger, MismatchingSchema)
+{
+   FileRaii fileGuard1("test_ntuple_merge_schema_in1.root");
+   FileRaii fileGuard2("test_ntuple_merge_schema_in2.root");
+   FileRaii fileGuard3("test_ntuple_merge_schema_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0.0, 404);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      model->MakeField<std::vector<std::int32_t>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   auto source1 = RPageSource::Create("ntuple", fileGuard1.GetPath());
+   auto source2 = RPageSource::Create("ntuple", fileGuard2.GetPath());
+   auto destination = RPageSink::Create("ntuple", fileGuard3.GetPath());
+   RNTupleMerger merger;
+   EXPECT_THROW(merger.Merge({source1.get(), source2.get()}, *destination), RException);
+}
+
+TEST(RNTupleMerger, FileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_filemerger_in1.root");
+   FileRaii fileGuard2("test_ntuple_filemerger_in2.root");
+   FileRaii fileGuard3("test_ntuple_filemerger_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0.0, 404);
+   WriteMergeInput(fileGuard2.GetPath(), 1000.0, 404);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      EXPECT_TRUE(fileMerger.AddFile(fileGuard1.GetPath().c_str()));
+      EXPECT_TRUE(fileMerger.AddFile(fileGuard2.GetPath().c_str()));
+      EXPECT_TRUE(fileMerger.OutputFile(fileGuard3.GetPath().c_str(), "RECREATE"));
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   EXPECT_EQ(200U, ntuple->GetNEntries());
+   EXPECT_EQ(6U, ntuple->GetDescriptor().GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int32_t>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      const int k = i % 100;
+      EXPECT_FLOAT_EQ((i < 100 ? 0.0 : 1000.0) + k, viewPt(i));
+      EXPECT_EQ(std::vector<std::int32_t>(k % 3, k), viewVec(i));
+   }
+}
@@ -89,3 +89,110 @@ TEST(Metrics, Timer)
    }
    EXPECT_GT(ctrWallTime.GetValue(), 0U);
 }
+
+TEST(Metrics, Export)
+{
+   RNTupleMetrics inner("inner");
+   auto ctrPlain = inner.MakeCounter<RNTuplePlainCounter *>("plain", "B", "say \"hello\"");
+   inner.MakeCounter<RNTupleCalcPerf *>("calc", "MB/s", "unavailable",
+      inner, [](const RNTupleMetrics &) -> std::pair<bool, double> { return {false, 0.}; });
+
+   RNTupleMetrics outer("outer");
+   auto ctrAtomic = outer.MakeCounter<RNTupleAtomicCounter *>("atomic", "", "example");
+   outer.ObserveMetrics(inner);
+   outer.Enable();
+   ctrPlain->SetValue(42);
+   ctrAtomic->Add(7);
+
+   std::vector<std::string> names;
+   outer.VisitCounters([&names](const std::string &qualifiedName, const RNTuplePerfCounter &) {
+      names.emplace_back(qualifiedName);
+   });
+   std::vector<std::string> expected{"outer.atomic", "outer.inner.plain", "outer.inner.calc"};
+   EXPECT_EQ(expected, names);
+
+   std::ostringstream json;
+   outer.PrintJSON(json);
+   EXPECT_EQ("{\n"
+             "  \"outer.atomic\": {\"value\": 7, \"unit\": \"\", \"description\": \"example\"},\n"
+             "  \"outer.inner.plain\": {\"value\": 42, \"unit\": \"B\", \"description\": \"say \\\"hello\\\"\"},\n"
+             "  \"outer.inner.calc\": {\"value\": null, \"unit\": \"MB/s\", \"description\": \"unavailable\"}\n"
+             "}\n", json.str());
+
+   std::ostringstream prometheus;
+   outer.PrintPrometheus(prometheus);
+   EXPECT_EQ("# HELP outer_atomic example\n"
+             "# TYPE outer_atomic gauge\n"
+             "outer_atomic 7\n"
+             "# HELP outer_inner_plain_bytes say \"hello\"\n"
+             "# TYPE outer_inner_plain_bytes gauge\n"
+             "outer_inner_plain_bytes 42\n"
+             "# HELP outer_inner_calc_MB_per_s unavailable\n"
+             "# TYPE outer_inner_calc_MB_per_s gauge\n"
+             "outer_inner_calc_MB_per_s NaN\n", prometheus.str());
+}
+
+TEST(Metrics, Sampler)
+{
+   RNTupleMetrics metrics("test");
+   auto ctr = metrics.MakeCounter<RNTupleAtomicCounter *>("atomic", "", "example");
+   auto plainCtr = metrics.MakeCounter<RNTuplePlainCounter *>("plain", "", "not sampled");
+   metrics.Enable();
+
+   std::atomic<int> nSamples{0};
+   std::atomic<bool> hasPlain{false};
+   std::int64_t lastValue = -1;
+   {
+      ROOT::Experimental::Detail::RNTupleMetricsSampler sampler(metrics, std::chrono::milliseconds(1),
+         [&](const RNTupleMetrics &m) {
+            nSamples++;
+            lastValue = m.GetCounter("test.atomic")->GetValueAsInt();
+            if (m.GetCounter("test.plain") != nullptr)
+               hasPlain = true;
+         });
+      ctr->Inc();
+      plainCtr->Inc();
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      ctr->Inc();
+   }
+   // At least the final sample when the sampler goes out of scope
+   EXPECT_GE(nSamples.load(), 1);
+   EXPECT_EQ(2, lastValue);
+   // Only the atomic counters are sampled
+   EXPECT_FALSE(hasPlain.load());
+}
+
+TEST(Metrics, SamplerCalculated)
+{
+   RNTupleMetrics inner("inner");
+   auto ctrSz = inner.MakeCounter<RNTupleAtomicCounter *>("szRead", "B", "volume read");
+   auto ctrTime = inner.MakeCounter<RNTupleAtomicCounter *>("timeWallRead", "ns", "wall clock time spent reading");
+   inner.MakeCounter<RNTupleCalcPerf *>("bwRead", "MB/s", "bandwidth",
+      inner, [](const RNTupleMetrics &metrics) -> std::pair<bool, double> {
+         if (const auto szRead = metrics.GetCounter("inner.szRead")) {
+            if (const auto timeWallRead = metrics.GetCounter("inner.timeWallRead")) {
+               if (auto walltime = timeWallRead->GetValueAsInt())
+                  return {true, 1000. * szRead->GetValueAsInt() / walltime};
+            }
+         }
+         return {false, -1.};
+      });
+   RNTupleMetrics outer("outer");
+   outer.ObserveMetrics(inner);
+   outer.Enable();
+
+   std::string lastPrometheus;
+   {
+      ROOT::Experimental::Detail::RNTupleMetricsSampler sampler(outer, std::chrono::milliseconds(1),
+         [&](const RNTupleMetrics &m) {
+            std::ostringstream prometheus;
+            m.PrintPrometheus(prometheus);
+            lastPrometheus = prometheus.str();
+         });
+      ctrSz->Add(500);
+      ctrTime->Add(1000);
+   }
+   // The calculated counter is computed from the copied values of the final sample
+   EXPECT_NE(std::string::npos, lastPrometheus.find("outer_inner_bwRead_MB_per_s 500.0"));
+   EXPECT_NE(std::string::npos, lastPrometheus.find("outer_inner_szRead_bytes 500\n"));
+}
@@ -65,6 +65,61 @@ TEST(MiniFile, Stream)
 }
 
 
+TEST(MiniFile, StreamV)
+{
+   FileRaii fileGuard("test_ntuple_minifile_streamv.root");
+
+   auto writer = std::unique_ptr<RNTupleFileWriter>(
+      RNTupleFileWriter::Recreate("MyNTuple", fileGuard.GetPath(), 0, ENTupleContainerFormat::kTFile));
+   char header = 'h';
+   char footer = 'f';
+   char blob = 'b';
+   std::vector<char> large(100000, 'l');
+   std::vector<RNTupleFileWriter::RBlobRequest> requests(3);
+   requests[0].fData = &blob;
+   requests[0].fNBytes = requests[0].fLen = 1;
+   requests[1].fData = large.data();
+   requests[1].fNBytes = requests[1].fLen = large.size();
+   requests[2].fData = &blob;
+   requests[2].fNBytes = requests[2].fLen = 1;
+
+   auto offHeader = writer->WriteNTupleHeader(&header, 1, 1);
+   writer->WriteBlobV(requests);
+   // Buffered writes after the vector write continue at the end of the last record
+   auto offBlob = writer->WriteBlob(&blob, 1, 1);
+   auto offFooter = writer->WriteNTupleFooter(&footer, 1, 1);
+   writer->Commit();
+   EXPECT_LT(offHeader, requests[0].fOffset);
+   EXPECT_LT(requests[0].fOffset, requests[1].fOffset);
+   EXPECT_LT(requests[1].fOffset + large.size(), requests[2].fOffset);
+   EXPECT_LT(requests[2].fOffset, offBlob);
+
+   auto rawFile = RRawFile::Create(fileGuard.GetPath());
+   RMiniFileReader reader(rawFile.get());
+   auto ntuple = reader.GetNTuple("MyNTuple").Inspect();
+   EXPECT_EQ(offHeader, ntuple.fSeekHeader);
+   EXPECT_EQ(offFooter, ntuple.fSeekFooter);
+
+   char buf;
+   reader.ReadBuffer(&buf, 1, requests[0].fOffset);
+   EXPECT_EQ(blob, buf);
+   std::vector<char> largeBuf(large.size());
+   reader.ReadBuffer(largeBuf.data(), largeBuf.size(), requests[1].fOffset);
+   EXPECT_EQ(large, largeBuf);
+   reader.ReadBuffer(&buf, 1, requests[2].fOffset);
+   EXPECT_EQ(blob, buf);
+   reader.ReadBuffer(&buf, 1, offBlob);
+   EXPECT_EQ(blob, buf);
+   reader.ReadBuffer(&buf, 1, offFooter);
+   EXPECT_EQ(footer, buf);
+
+   auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "READ"));
+   ASSERT_TRUE(file);
+   auto k = std::unique_ptr<RNTuple>(file->Get<RNTuple>("MyNTuple"));
+   EXPECT_EQ(ntuple, *k);
+}
+
+
 TEST(MiniFile, Proper)
 {
    FileRaii fileGuard("test_ntuple_minifile_proper.root");
@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <cmath>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -32,3 +34,297 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, Split)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::int32_t i32[] = {0x04030201, 0x08070605, 0x0c0b0a09};
+   unsigned char split[12];
+   element.Pack(split, i32, 3);
+   // Little-endian byte planes
+   unsigned char expected[] = {0x01, 0x05, 0x09, 0x02, 0x06, 0x0a, 0x03, 0x07, 0x0b, 0x04, 0x08, 0x0c};
+   for (unsigned i = 0; i < 12; ++i) {
+      EXPECT_EQ(expected[i], split[i]);
+   }
+   std::int32_t u32[3];
+   element.Unpack(u32, split, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(i32[i], u32[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64> elementReal64(
+      nullptr);
+   double d[] = {1.0, -2.5, 3.14159, 1e-300, 0.0};
+   unsigned char splitReal64[sizeof(d)];
+   elementReal64.Pack(splitReal64, d, 5);
+   double e[5];
+   elementReal64.Unpack(e, splitReal64, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(d[i], e[i]);
+   }
+}
+
+TEST(Packing, SplitFields)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = std::make_unique<RField<float>>("pt");
+   fieldPt->SetColumnType(EColumnType::kSplitReal32);
+   EXPECT_EQ(EColumnType::kSplitReal32, fieldPt->GetColumnType());
+   model->AddField(std::move(fieldPt));
+   auto fieldE = std::make_unique<RField<double>>("E");
+   fieldE->SetColumnType(EColumnType::kSplitReal64);
+   model->AddField(std::move(fieldE));
+   auto fieldId = std::make_unique<RField<std::uint64_t>>("id");
+   fieldId->SetColumnType(EColumnType::kSplitInt64);
+   model->AddField(std::move(fieldId));
+   auto fieldCharge = std::make_unique<RField<std::int32_t>>("charge");
+   EXPECT_EQ(EColumnType::kInt32, fieldCharge->GetColumnType());
+   EXPECT_THROW(fieldCharge->SetColumnType(EColumnType::kSplitReal32), RException);
+   fieldCharge->SetColumnType(EColumnType::kSplitInt32);
+   model->AddField(std::move(fieldCharge));
+
+   auto wrPt = model->Get<float>("pt");
+   auto wrE = model->Get<double>("E");
+   auto wrId = model->Get<std::uint64_t>("id");
+   auto wrCharge = model->Get<std::int32_t>("charge");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 25000; ++i) {
+         *wrPt = 1.5f * i;
+         *wrE = -0.25 * i;
+         *wrId = (std::uint64_t(1) << 40) + i;
+         *wrCharge = (i % 2) ? -1 : 1;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto columnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   EXPECT_EQ(EColumnType::kSplitReal32, desc.GetColumnDescriptor(columnId).GetModel().GetType());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewE = ntuple->GetView<double>("E");
+   auto viewId = ntuple->GetView<std::uint64_t>("id");
+   auto viewCharge = ntuple->GetView<std::int32_t>("charge");
+   ASSERT_EQ(25000U, ntuple->GetNEntries());
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(1.5f * i, viewPt(i));
+      EXPECT_EQ(-0.25 * i, viewE(i));
+      EXPECT_EQ((std::uint64_t(1) << 40) + i, viewId(i));
+      EXPECT_EQ((i % 2) ? -1 : 1, viewCharge(i));
+   }
+}
+
+TEST(Packing, DeltaZigzag)
+{
+   ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                    ROOT::Experimental::EColumnType::kDeltaIndex>
+      element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
+   ClusterSize_t offsets[] = {ClusterSize_t(1000), ClusterSize_t(1002), ClusterSize_t(1002), ClusterSize_t(1300)};
+   unsigned char packed[sizeof(offsets)];
+   element.Pack(packed, offsets, 4);
+   // Deltas 1000, 2, 0, 298 split into (little-endian) byte planes
+   unsigned char expected[] = {0xe8, 0x02, 0x00, 0x2a, 0x03, 0x00, 0x00, 0x01,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+   for (unsigned i = 0; i < sizeof(expected); ++i) {
+      EXPECT_EQ(expected[i], packed[i]);
+   }
+   ClusterSize_t unpacked[4];
+   element.Unpack(unpacked, packed, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(offsets[i], unpacked[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kZigzagInt32>
+      elementZigzag(nullptr);
+   std::int32_t i32[] = {0, -1, 1, -2, 2147483647, -2147483647 - 1};
+   unsigned char packedZigzag[sizeof(i32)];
+   elementZigzag.Pack(packedZigzag, i32, 6);
+   // Least significant byte plane: 0, 1, 2, 3, 0xfe, 0xff
+   EXPECT_EQ(0, packedZigzag[0]);
+   EXPECT_EQ(1, packedZigzag[1]);
+   EXPECT_EQ(2, packedZigzag[2]);
+   EXPECT_EQ(3, packedZigzag[3]);
+   for (unsigned i = 6; i < 4 * 6; ++i) {
+      if ((i % 6) < 4)
+         EXPECT_EQ(0, packedZigzag[i]);
+   }
+   std::int32_t u32[6];
+   elementZigzag.Unpack(u32, packedZigzag, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(i32[i], u32[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kZigzagInt64>
+      elementZigzag64(nullptr);
+   std::int64_t i64[] = {0, -1, 1, std::int64_t(1) << 62, -(std::int64_t(1) << 62)};
+   unsigned char packedZigzag64[sizeof(i64)];
+   elementZigzag64.Pack(packedZigzag64, i64, 5);
+   std::int64_t u64[5];
+   elementZigzag64.Unpack(u64, packedZigzag64, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(i64[i], u64[i]);
+   }
+}
+
+TEST(Packing, DeltaZigzagFields)
+{
+   FileRaii fileGuard("test_ntuple_packing_delta.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldHits = std::make_unique<RField<std::vector<float>>>("hits");
+   EXPECT_EQ(EColumnType::kIndex, fieldHits->GetColumnType());
+   fieldHits->SetColumnType(EColumnType::kDeltaIndex);
+   model->AddField(std::move(fieldHits));
+   auto fieldTag = std::make_unique<RField<std::string>>("tag");
+   fieldTag->SetColumnType(EColumnType::kDeltaIndex);
+   model->AddField(std::move(fieldTag));
+   auto fieldCharge = std::make_unique<RField<std::int32_t>>("charge");
+   fieldCharge->SetColumnType(EColumnType::kZigzagInt32);
+   model->AddField(std::move(fieldCharge));
+
+   auto wrHits = model->Get<std::vector<float>>("hits");
+   auto wrTag = model->Get<std::string>("tag");
+   auto wrCharge = model->Get<std::int32_t>("charge");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 25000; ++i) {
+         wrHits->clear();
+         for (unsigned j = 0; j < i % 5; ++j)
+            wrHits->push_back(float(j));
+         *wrTag = std::string(i % 3, 'x');
+         *wrCharge = (i % 2) ? -int(i) : int(i);
+         ntuple->Fill();
+         if (i == 10000)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   auto columnId = desc.FindColumnId(desc.FindFieldId("hits"), 0);
+   EXPECT_EQ(EColumnType::kDeltaIndex, desc.GetColumnDescriptor(columnId).GetModel().GetType());
+
+   auto viewHits = ntuple->GetView<std::vector<float>>("hits");
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   auto viewCharge = ntuple->GetView<std::int32_t>("charge");
+   ASSERT_EQ(25000U, ntuple->GetNEntries());
+   for (auto i : ntuple->GetEntryRange()) {
+      auto hits = viewHits(i);
+      ASSERT_EQ(i % 5, hits.size());
+      for (unsigned j = 0; j < hits.size(); ++j)
+         EXPECT_EQ(float(j), hits[j]);
+      EXPECT_EQ(std::string(i % 3, 'x'), viewTag(i));
+      EXPECT_EQ((i % 2) ? -int(i) : int(i), viewCharge(i));
+   }
+}
+
+TEST(Packing, ReducedPrecision)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   float f[] = {0.0f, 1.0f, -2.5f, 65504.0f, 1e6f, 6.103515625e-05f, 5.9604645e-08f};
+   std::uint16_t half[7];
+   element.Pack(half, f, 7);
+   std::uint16_t expected[] = {0x0000, 0x3c00, 0xc100, 0x7bff, 0x7c00, 0x0400, 0x0001};
+   for (unsigned i = 0; i < 7; ++i) {
+      EXPECT_EQ(expected[i], half[i]);
+   }
+   float g[7];
+   element.Unpack(g, half, 7);
+   for (unsigned i = 0; i < 7; ++i) {
+      if (i == 4)
+         EXPECT_TRUE(std::isinf(g[i]));
+      else
+         EXPECT_EQ(f[i], g[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal8> element8(nullptr);
+   double d[] = {1.0, -3.0, 1.3, 0.0};
+   std::uint8_t real8[4];
+   element8.Pack(real8, d, 4);
+   double e[4];
+   element8.Unpack(e, real8, 4);
+   EXPECT_EQ(1.0, e[0]);
+   EXPECT_EQ(-3.0, e[1]);
+   EXPECT_EQ(1.25, e[2]);
+   EXPECT_EQ(0.0, e[3]);
+
+   element8.SetValueRange(-1.0, 1.0);
+   double q[] = {-2.0, -1.0, 0.0, 1.0, 2.0};
+   std::uint8_t quantized[5];
+   element8.Pack(quantized, q, 5);
+   EXPECT_EQ(0, quantized[0]);
+   EXPECT_EQ(0, quantized[1]);
+   EXPECT_EQ(128, quantized[2]);
+   EXPECT_EQ(255, quantized[3]);
+   EXPECT_EQ(255, quantized[4]);
+   double r[5];
+   element8.Unpack(r, quantized, 5);
+   EXPECT_EQ(-1.0, r[0]);
+   EXPECT_NEAR(0.0, r[2], 2.0 / 255);
+   EXPECT_EQ(1.0, r[4]);
+}
+
+TEST(Packing, ReducedPrecisionFields)
+{
+   FileRaii fileGuard("test_ntuple_packing_reduced.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = std::make_unique<RField<float>>("pt");
+   fieldPt->SetColumnType(EColumnType::kReal16);
+   model->AddField(std::move(fieldPt));
+   auto fieldEta = std::make_unique<RField<double>>("eta");
+   fieldEta->SetColumnType(EColumnType::kReal16);
+   EXPECT_THROW(fieldEta->SetValueRange(1.0, -1.0), RException);
+   fieldEta->SetValueRange(-5.0, 5.0);
+   model->AddField(std::move(fieldEta));
+   auto fieldE = std::make_unique<RField<double>>("E");
+   fieldE->SetColumnType(EColumnType::kReal32);
+   model->AddField(std::move(fieldE));
+
+   auto wrPt = model->Get<float>("pt");
+   auto wrEta = model->Get<double>("eta");
+   auto wrE = model->Get<double>("E");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 1000; ++i) {
+         *wrPt = 0.5f * i;
+         *wrEta = -5.0 + 0.01 * i;
+         *wrE = 1.0 / (i + 1);
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = ntuple->GetDescriptor();
+   const auto &columnModelEta = desc.GetColumnDescriptor(desc.FindColumnId(desc.FindFieldId("eta"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal16, columnModelEta.GetType());
+   EXPECT_TRUE(columnModelEta.HasValueRange());
+   EXPECT_EQ(-5.0, columnModelEta.GetValueMin());
+   EXPECT_EQ(5.0, columnModelEta.GetValueMax());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewEta = ntuple->GetView<double>("eta");
+   auto viewE = ntuple->GetView<double>("E");
+   for (auto i : ntuple->GetEntryRange()) {
+      // Half precision has 11 significant bits
+      EXPECT_NEAR(0.5f * i, viewPt(i), 0.5f * i / 2048);
+      EXPECT_NEAR(-5.0 + 0.01 * i, viewEta(i), 10.0 / 65535);
+      EXPECT_EQ(static_cast<float>(1.0 / (i + 1)), viewE(i));
+   }
+}
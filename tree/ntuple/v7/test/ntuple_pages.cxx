@@ -12,6 +12,55 @@ TEST(Pages, Allocation)
    allocator.DeletePage(page);
 }
 
+TEST(Pages, AllocatorPool)
+{
+   auto defaultMaxRetainedBytes = RPageAllocatorPool::GetMaxRetainedBytes();
+   RPageAllocatorPool::SetMaxRetainedBytes(0);
+   RPageAllocatorPool::SetMaxRetainedBytes(defaultMaxRetainedBytes);
+   EXPECT_EQ(0U, RPageAllocatorPool::GetRetainedBytes());
+
+   auto page = RPageAllocatorPool::NewPage(42, 4, 10000);
+   EXPECT_FALSE(page.IsNull());
+   EXPECT_EQ(40000U, page.GetCapacity());
+   auto buffer = page.GetBuffer();
+   RPageAllocatorPool::DeletePage(page);
+   // Rounded up to the next size class
+   EXPECT_LE(40000U, RPageAllocatorPool::GetRetainedBytes());
+   EXPECT_GE(50000U, RPageAllocatorPool::GetRetainedBytes());
+
+   // Requests in the same size class reuse the memory
+   auto reused = RPageAllocatorPool::Allocate(39000);
+   EXPECT_EQ(buffer, reused);
+   EXPECT_EQ(0U, RPageAllocatorPool::GetRetainedBytes());
+   RPageAllocatorPool::Release(reused, 39000);
+
+   // Memory released by other threads ends up in the global depot
+   std::thread worker([]() { RPageAllocatorPool::Release(RPageAllocatorPool::Allocate(100), 100); });
+   worker.join();
+   EXPECT_LT(40000U, RPageAllocatorPool::GetRetainedBytes());
+
+   // Blocks beyond the limit and very large blocks are not retained
+   RPageAllocatorPool::SetMaxRetainedBytes(0);
+   EXPECT_EQ(0U, RPageAllocatorPool::GetRetainedBytes());
+   RPageAllocatorPool::Release(RPageAllocatorPool::Allocate(1000), 1000);
+   EXPECT_EQ(0U, RPageAllocatorPool::GetRetainedBytes());
+   RPageAllocatorPool::SetMaxRetainedBytes(defaultMaxRetainedBytes);
+   auto large = RPageAllocatorPool::kMaxClassBytes + 1;
+   RPageAllocatorPool::Release(RPageAllocatorPool::Allocate(large), large);
+   EXPECT_EQ(0U, RPageAllocatorPool::GetRetainedBytes());
+
+   // Buffers from MakeBuffer() go back to the pool on destruction
+   unsigned char *address = nullptr;
+   {
+      auto pooled = RPageAllocatorPool::MakeBuffer(39000);
+      address = pooled.get();
+   }
+   EXPECT_LE(39000U, RPageAllocatorPool::GetRetainedBytes());
+   reused = RPageAllocatorPool::Allocate(39000);
+   EXPECT_EQ(address, reused);
+   RPageAllocatorPool::Release(reused, 39000);
+}
+
 TEST(Pages, Pool)
 {
    RPagePool pool;
@@ -55,3 +104,50 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolPendingPage)
+{
+   RPagePool pool;
+   RPage::RClusterInfo clusterInfo(2, 40);
+   pool.AnnouncePage(1, 50, 10, clusterInfo);
+
+   // Pages that are not pending are not waited for
+   auto page = pool.GetPage(1, 60);
+   EXPECT_TRUE(page.IsNull());
+   page = pool.GetPage(0, 55);
+   EXPECT_TRUE(page.IsNull());
+
+   unsigned char buffer[10];
+   std::thread unzipThread([&pool, &buffer, clusterInfo]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      RPage unzippedPage(1, buffer, 10, 1);
+      unzippedPage.TryGrow(10);
+      unzippedPage.SetWindow(50, clusterInfo);
+      pool.PreloadPage(unzippedPage, RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}));
+   });
+   // Blocks until the page is preloaded
+   page = pool.GetPage(1, ROOT::Experimental::RClusterIndex(2, 15));
+   unzipThread.join();
+   ASSERT_FALSE(page.IsNull());
+   EXPECT_EQ(buffer, page.GetBuffer());
+   EXPECT_EQ(50U, page.GetGlobalRangeFirst());
+   pool.ReturnPage(page);
+}
+
+TEST(Pages, PoolDiscardPendingPage)
+{
+   RPagePool pool;
+   RPage::RClusterInfo clusterInfo(2, 40);
+   pool.AnnouncePage(1, 50, 10, clusterInfo);
+
+   std::thread unzipThread([&pool]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      pool.DiscardPendingPage(1, 50);
+   });
+   // Blocks until the page is discarded and then returns a null page rather than waiting forever
+   auto page = pool.GetPage(1, 55);
+   unzipThread.join();
+   EXPECT_TRUE(page.IsNull());
+   page = pool.GetPage(1, ROOT::Experimental::RClusterIndex(2, 15));
+   EXPECT_TRUE(page.IsNull());
+}
@@ -0,0 +1,54 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<std::uint64_t>("id");
+   model->MakeField<std::vector<float>>("vec");
+
+   constexpr unsigned int kNThreads = 4;
+   constexpr std::uint64_t kNEntriesPerThread = 2500;
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            auto id = entry->Get<std::uint64_t>("id");
+            auto vec = entry->Get<std::vector<float>>("vec");
+            for (std::uint64_t i = 0; i < kNEntriesPerThread; ++i) {
+               *id = t * kNEntriesPerThread + i;
+               vec->assign(*id % 5, static_cast<float>(*id));
+               context->Fill(*entry);
+               if (i % 1000 == 999)
+                  context->CommitCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      EXPECT_EQ(kNThreads * kNEntriesPerThread, writer->GetNEntries());
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   ASSERT_EQ(kNThreads * kNEntriesPerThread, reader->GetNEntries());
+   // 3 clusters per thread: two full ones and the remainder committed by the fill context's destructor
+   EXPECT_EQ(kNThreads * 3, reader->GetDescriptor().GetNClusters());
+
+   auto viewId = reader->GetView<std::uint64_t>("id");
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   std::vector<bool> seen(kNThreads * kNEntriesPerThread, false);
+   for (auto i : reader->GetEntryRange()) {
+      auto id = viewId(i);
+      ASSERT_LT(id, seen.size());
+      EXPECT_FALSE(seen[id]);
+      seen[id] = true;
+      const auto &vec = viewVec(i);
+      ASSERT_EQ(id % 5, vec.size());
+      for (auto v : vec)
+         EXPECT_FLOAT_EQ(static_cast<float>(id), v);
+   }
+}
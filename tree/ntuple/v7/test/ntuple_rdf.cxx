@@ -27,3 +27,28 @@ TEST(RNTuple, RDF)
    auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath());
    EXPECT_EQ(42.0, *rdf.Min("pt"));
 }
+
+TEST(RNTuple, RDFRangeFilter)
+{
+   FileRaii fileGuard("test_ntuple_rdf_range_filter.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if (i % 2 == 1)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("myNTuple", fileGuard.GetPath()));
+   ds->AddRangeFilter("pt", 2.5, 5.5);
+   EXPECT_THROW(ds->AddRangeFilter("nonexisting", 0.0, 1.0), std::runtime_error);
+   ROOT::RDataFrame rdf(std::move(ds));
+   // Only the clusters with the entries [2, 4) and [4, 6) are read; the filter is still needed for the exact selection
+   EXPECT_EQ(4U, *rdf.Count());
+   EXPECT_EQ(3U, *rdf.Filter([](float pt) { return pt > 2.5 && pt < 5.5; }, {"pt"}).Count());
+}
@@ -15,6 +15,7 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPagePool.hxx>
@@ -26,6 +27,7 @@
 #include <RZip.h>
 #include <TClass.h>
 #include <TFile.h>
+#include <TFileMerger.h>
 #include <TRandom3.h>
 
 #include "gmock/gmock.h"
@@ -54,6 +56,7 @@ using ENTupleStructure = ROOT::Experimental::ENTupleStructure;
 using NTupleSize_t = ROOT::Experimental::NTupleSize_t;
 using RColumnModel = ROOT::Experimental::RColumnModel;
 using RDanglingFieldDescriptor = ROOT::Experimental::RDanglingFieldDescriptor;
+using REntry = ROOT::Experimental::REntry;
 using RException = ROOT::Experimental::RException;
 template <class T>
 using RField = ROOT::Experimental::RField<T>;
@@ -71,18 +74,25 @@ using RNTupleCompressor = ROOT::Experimental::Detail::RNTupleCompressor;
 using RNTupleDecompressor = ROOT::Experimental::Detail::RNTupleDecompressor;
 using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
 using RNTupleDescriptorBuilder = ROOT::Experimental::RNTupleDescriptorBuilder;
+using RNTupleFillContext = ROOT::Experimental::RNTupleFillContext;
 using RNTupleFileWriter = ROOT::Experimental::Internal::RNTupleFileWriter;
 using RNTupleReader = ROOT::Experimental::RNTupleReader;
 using RNTupleReadOptions = ROOT::Experimental::RNTupleReadOptions;
 using RNTupleWriter = ROOT::Experimental::RNTupleWriter;
 using RNTupleWriteOptions = ROOT::Experimental::RNTupleWriteOptions;
+using RNTupleMerger = ROOT::Experimental::RNTupleMerger;
 using RNTupleMetrics = ROOT::Experimental::Detail::RNTupleMetrics;
 using RNTupleModel = ROOT::Experimental::RNTupleModel;
+using RNTupleParallelWriter = ROOT::Experimental::RNTupleParallelWriter;
+using RNTuplePerfCounter = ROOT::Experimental::Detail::RNTuplePerfCounter;
 using RNTuplePlainCounter = ROOT::Experimental::Detail::RNTuplePlainCounter;
 using RNTuplePlainTimer = ROOT::Experimental::Detail::RNTuplePlainTimer;
 using RNTupleVersion = ROOT::Experimental::RNTupleVersion;
+template <class T>
+using RNTupleView = ROOT::Experimental::RNTupleView<T>;
 using RPage = ROOT::Experimental::Detail::RPage;
 using RPageAllocatorHeap = ROOT::Experimental::Detail::RPageAllocatorHeap;
+using RPageAllocatorPool = ROOT::Experimental::Detail::RPageAllocatorPool;
 using RPageDeleter = ROOT::Experimental::Detail::RPageDeleter;
 using RPagePool = ROOT::Experimental::Detail::RPagePool;
 using RPageSink = ROOT::Experimental::Detail::RPageSink;
@@ -121,3 +121,106 @@ TEST(RNTuple, Composable)
    }
    EXPECT_EQ(8, nEv);
 }
+
+TEST(RNTuple, ViewMapV)
+{
+   FileRaii fileGuard("test_ntuple_view_mapv.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 100000; ++i) {
+         *fieldPt = i;
+         ntuple->Fill();
+         if (i == 50000)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   NTupleSize_t nPages = 0;
+   NTupleSize_t nItems = 0;
+   for (NTupleSize_t i = 0; i < ntuple->GetNEntries(); i += nItems) {
+      const float *pt = viewPt.MapV(i, nItems);
+      ASSERT_GT(nItems, 0U);
+      ASSERT_LE(i + nItems, ntuple->GetNEntries());
+      for (NTupleSize_t j = 0; j < nItems; ++j) {
+         EXPECT_EQ(static_cast<float>(i + j), pt[j]);
+      }
+      nPages++;
+   }
+   // At least one page per cluster
+   EXPECT_GE(nPages, 2U);
+
+   const float *pt = viewPt.MapV(ROOT::Experimental::RClusterIndex(1, 10), nItems);
+   EXPECT_EQ(50011.0f, pt[0]);
+   EXPECT_GT(nItems, 0U);
+}
+
+TEST(RNTuple, ViewLazyColumns)
+{
+   FileRaii fileGuard("test_ntuple_view_lazy_columns.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldEta = model->MakeField<float>("eta");
+   auto fieldKlass = model->MakeField<CustomStruct>("klass");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned i = 0; i < 100; ++i) {
+         *fieldPt = i;
+         *fieldEta = -1.0 * i;
+         fieldKlass->a = 2.0 * i;
+         fieldKlass->v1 = std::vector<float>(100, i);
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::int64_t szReadViews = 0;
+   {
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      ntuple->EnableMetrics();
+      // Dropping a view deactivates its columns unless another view still uses them
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewPtCopy = std::make_unique<RNTupleView<float>>(ntuple->GetView<float>("pt"));
+      { auto viewEta = ntuple->GetView<float>("eta"); }
+      // Sub fields of classes are activated on their own
+      auto viewA = ntuple->GetView<float>("klass.a");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(2.0f * i, viewA(i));
+         if (i == 15)
+            viewPtCopy.reset();
+         else if (i < 15)
+            EXPECT_EQ(static_cast<float>(i), (*viewPtCopy)(i));
+      }
+      szReadViews = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt();
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   ntuple->EnableMetrics();
+   // An entry covering a subset of the model's fields only connects these fields
+   auto entry = std::make_unique<REntry>();
+   entry->CaptureValue(ntuple->GetModel()->GetDefaultEntry()->GetValue("eta"));
+   for (auto i : ntuple->GetEntryRange()) {
+      ntuple->LoadEntry(i, *entry);
+      EXPECT_EQ(-1.0f * i, *entry->Get<float>("eta"));
+   }
+   for (auto f : ntuple->GetModel()->GetFieldZero()->GetSubFields())
+      EXPECT_EQ(f->GetName() == "eta", f->IsConnected());
+
+   // Loading the default entry connects the remaining fields
+   for (auto i : ntuple->GetEntryRange()) {
+      ntuple->LoadEntry(i);
+      EXPECT_EQ(static_cast<float>(i), *ntuple->GetModel()->Get<float>("pt"));
+      EXPECT_EQ(100U, ntuple->GetModel()->Get<CustomStruct>("klass")->v1.size());
+   }
+   for (auto f : ntuple->GetModel()->GetFieldZero()->GetSubFields())
+      EXPECT_TRUE(f->IsConnected());
+   auto szReadAll = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szReadPayload")->GetValueAsInt();
+   EXPECT_LT(szReadViews, szReadAll);
+}
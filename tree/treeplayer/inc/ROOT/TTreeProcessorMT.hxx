@@ -26,6 +26,8 @@
 #include "ROOT/TThreadExecutor.hxx"
 
 #include <functional>
+#include <mutex>
+#include <string>
 #include <utility> // std::pair
 #include <vector>
 
@@ -82,6 +84,15 @@ public:
 } // End of namespace Internal
 
 class TTreeProcessorMT {
+public:
+   /// Processing time of a task, i.e. of a call to the function passed to Process
+   struct TTaskTiming {
+      std::string fFileName; ///< The file the entries of the task belong to
+      Long64_t fStart;       ///< First entry processed, as in TTreeReader::GetEntriesRange
+      Long64_t fEnd;         ///< One past the last entry processed
+      double fRealTime;      ///< Elapsed time in seconds
+   };
+
 private:
    const std::vector<std::string> fFileNames; ///< Names of the files
    const std::vector<std::string> fTreeNames; ///< TTree names (always same size and ordering as fFileNames)
@@ -94,6 +105,10 @@ private:
    // Must be declared after fPool, for IMT to be initialized first!
    ROOT::TThreadedObject<ROOT::Internal::TTreeView> fTreeView{TNumSlots{ROOT::GetThreadPoolSize()}};
 
+   bool fDynamicLoadBalancing = false;      ///< Whether tasks are formed at run time, see SetDynamicLoadBalancing
+   std::vector<TTaskTiming> fTaskTimings;   ///< Timings of the tasks of the last call to Process
+   std::mutex fTaskTimingsMutex;            ///< Protects fTaskTimings
+
    Internal::FriendInfo GetFriendInfo(TTree &tree);
    std::vector<std::string> FindTreeNames();
    static unsigned int fgMaxTasksPerFilePerWorker;
@@ -108,6 +123,9 @@ public:
    void Process(std::function<void(TTreeReader &)> func);
    static void SetMaxTasksPerFilePerWorker(unsigned int m);
    static unsigned int GetMaxTasksPerFilePerWorker();
+   void SetDynamicLoadBalancing(bool enable);
+   bool GetDynamicLoadBalancing() const;
+   const std::vector<TTaskTiming> &GetTaskTimings() const;
 };
 
 } // End of namespace ROOT
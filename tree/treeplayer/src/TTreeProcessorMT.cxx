@@ -21,12 +21,18 @@ on a subrange of entries by using that TTreeReader.
 The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the subranges,
 each corresponding to a cluster in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
-objects.
+objects. The subranges can also be formed while processing, to balance the load of the
+threads (see SetDynamicLoadBalancing). The processing time of each subrange is available
+via GetTaskTimings.
 */
 
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
 using namespace ROOT;
 
 namespace {
@@ -127,7 +133,7 @@ ConvertToElistClusters(std::vector<std::vector<EntryCluster>> &&clusters, TEntry
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryCluster>>, std::vector<Long64_t>>;
 
 ////////////////////////////////////////////////////////////////////////
-/// Return a vector of cluster boundaries for the given tree and files.
+/// Return a vector of cluster boundaries for the given tree and files, and the number of entries of each file.
 static ClustersAndEntries
 MakeClusters(const std::vector<std::string> &treeNames, const std::vector<std::string> &fileNames)
 {
@@ -171,6 +177,13 @@ MakeClusters(const std::vector<std::string> &treeNames, const std::vector<std::s
       entriesPerFile.emplace_back(entries);
    }
 
+   return std::make_pair(std::move(clustersPerFile), std::move(entriesPerFile));
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Merge the clusters of each file into at most TTreeProcessorMT::GetMaxTasksPerFilePerWorker() ranges per worker.
+static std::vector<std::vector<EntryCluster>> MergeClusters(std::vector<std::vector<EntryCluster>> &&clustersPerFile)
+{
    // Here we "fuse" together clusters if the number of clusters is too big with respect to
    // the number of slots, otherwise we can incurr in an overhead which is big enough
    // to make parallelisation detrimental to performance.
@@ -214,7 +227,7 @@ MakeClusters(const std::vector<std::string> &treeNames, const std::vector<std::s
       }
    }
 
-   return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
+   return eventRangesPerFile;
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -582,6 +595,8 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    ClustersAndEntries clusterAndEntries{};
    if (shouldRetrieveAllClusters) {
       clusterAndEntries = MakeClusters(fTreeNames, fFileNames);
+      if (!fDynamicLoadBalancing)
+         clusterAndEntries.first = MergeClusters(std::move(clusterAndEntries.first));
       if (hasEntryList)
          clusterAndEntries.first = ConvertToElistClusters(std::move(clusterAndEntries.first), fEntryList, fTreeNames,
                                                           fFileNames, clusterAndEntries.second);
@@ -602,8 +617,10 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       // either all tree names or just the single tree to process
       const auto &theseTrees = shouldRetrieveAllClusters ? fTreeNames : std::vector<std::string>({fTreeNames[fileIdx]});
       // Evaluate clusters (with local entry numbers) and number of entries for this file, if needed
-      const auto theseClustersAndEntries =
+      auto theseClustersAndEntries =
          shouldRetrieveAllClusters ? ClustersAndEntries{} : MakeClusters(theseTrees, theseFiles);
+      if (!shouldRetrieveAllClusters && !fDynamicLoadBalancing)
+         theseClustersAndEntries.first = MergeClusters(std::move(theseClustersAndEntries.first));
 
       // All clusters for the file to process, either with global or local entry numbers
       const auto &thisFileClusters = shouldRetrieveAllClusters ? clusters[fileIdx] : theseClustersAndEntries.first[0];
@@ -615,15 +632,45 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       auto processCluster = [&](const EntryCluster &c) {
          auto r = fTreeView->GetTreeReader(c.start, c.end, theseTrees, theseFiles, fFriendInfo, fEntryList,
                                            theseEntries, friendEntries);
+         const auto taskStart = std::chrono::steady_clock::now();
          func(*r);
+         const std::chrono::duration<double> realTime = std::chrono::steady_clock::now() - taskStart;
+         std::lock_guard<std::mutex> lock(fTaskTimingsMutex);
+         fTaskTimings.emplace_back(TTaskTiming{fFileNames[fileIdx], c.start, c.end, realTime.count()});
       };
 
-      fPool.Foreach(processCluster, thisFileClusters);
+      if (!fDynamicLoadBalancing) {
+         fPool.Foreach(processCluster, thisFileClusters);
+         return;
+      }
+
+      // Guided self-scheduling: one task per worker repeatedly takes a share of the clusters that are left, which
+      // shrinks as the file is consumed. Workers that are done with other files join the processing of the remaining
+      // clusters of this one, in smaller and smaller ranges, so that no worker stays idle waiting for a large range.
+      // As for the static partitioning, there are about GetMaxTasksPerFilePerWorker() tasks per file per worker at most.
+      const std::size_t nClusters = thisFileClusters.size();
+      const std::size_t nWorkers = fPool.GetPoolSize();
+      const std::size_t maxTasksPerFile = fgMaxTasksPerFilePerWorker * nWorkers;
+      const std::size_t minClustersPerTask = std::max<std::size_t>(1u, nClusters / maxTasksPerFile);
+      std::atomic<std::size_t> nextCluster(0u);
+      auto processClusters = [&]() {
+         std::size_t begin = nextCluster.load();
+         while (begin < nClusters) {
+            const auto share = (nClusters - begin + 2 * nWorkers - 1) / (2 * nWorkers);
+            const auto end = std::min(nClusters, begin + std::max(minClustersPerTask, share));
+            if (!nextCluster.compare_exchange_weak(begin, end))
+               continue; // another worker took clusters in the meantime, begin has been updated
+            processCluster(EntryCluster{thisFileClusters[begin].start, thisFileClusters[end - 1].end});
+            begin = nextCluster.load();
+         }
+      };
+      fPool.Foreach(processClusters, static_cast<unsigned>(std::min(nWorkers, nClusters)));
    };
 
    std::vector<std::size_t> fileIdxs(fFileNames.size());
    std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
 
+   fTaskTimings.clear();
    fPool.Foreach(processFile, fileIdxs);
 }
 
@@ -646,3 +693,34 @@ void TTreeProcessorMT::SetMaxTasksPerFilePerWorker(unsigned int maxTasksPerFile)
 {
    fgMaxTasksPerFilePerWorker = maxTasksPerFile;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Sets whether the ranges of entries processed by each task are formed at run time.
+/// \param[in] enable `true` to form the ranges at run time, `false` (the default) to form them before processing.
+///
+/// By default, the clusters of each file are merged in at most GetMaxTasksPerFilePerWorker() ranges per worker
+/// before processing starts, and each range is processed by a task. If the processing time of the ranges varies a
+/// lot, e.g. because the files differ greatly in size or because of the cost of the user function, a few large ranges
+/// can keep some workers busy long after the others are done.
+/// With dynamic load balancing, workers repeatedly take a share of the clusters of a file that are left, which
+/// shrinks as the file is consumed: processing starts with large ranges and ends with small ones, which idle workers
+/// share. The number of tasks is not known in advance, but it is still limited to about
+/// GetMaxTasksPerFilePerWorker() per file per worker.
+void TTreeProcessorMT::SetDynamicLoadBalancing(bool enable)
+{
+   fDynamicLoadBalancing = enable;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Returns whether the ranges of entries processed by each task are formed at run time.
+bool TTreeProcessorMT::GetDynamicLoadBalancing() const
+{
+   return fDynamicLoadBalancing;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Returns the processing time of each task of the last call to Process, in order of completion.
+const std::vector<TTreeProcessorMT::TTaskTiming> &TTreeProcessorMT::GetTaskTimings() const
+{
+   return fTaskTimings;
+}
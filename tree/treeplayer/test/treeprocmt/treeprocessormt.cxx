@@ -349,6 +349,47 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, DynamicLoadBalancing)
+{
+   const auto nEvents = 991;
+   const auto filename = "TreeProcessorMT_DynamicLoadBalancing.root";
+   const auto treename = "t";
+   WriteFileManyClusters(nEvents, treename, filename);
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> clusters;
+   auto nEntries = 0U;
+   auto get_clusters = [&](TTreeReader &t) {
+      auto n = 0U;
+      while (t.Next())
+         ++n;
+      std::lock_guard<std::mutex> l(m);
+      clusters.emplace_back(t.GetEntriesRange());
+      nEntries += n;
+   };
+
+   ROOT::EnableImplicitMT(4);
+
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.SetDynamicLoadBalancing(true);
+   EXPECT_TRUE(p.GetDynamicLoadBalancing());
+   p.Process(get_clusters);
+
+   EXPECT_EQ(nEntries, 991U);
+   CheckClusters(clusters, nEvents);
+   // ranges shrink as the file is consumed, down to the size that gives 96 ranges for the whole file
+   EXPECT_LE(clusters.size(), 2U * 96U);
+   const auto &timings = p.GetTaskTimings();
+   ASSERT_EQ(timings.size(), clusters.size());
+   for (const auto &t : timings) {
+      EXPECT_EQ(t.fFileName, filename);
+      EXPECT_GE(t.fRealTime, 0.);
+   }
+
+   gSystem->Unlink(filename);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};